@@ -0,0 +1,105 @@
+// Imports a whole list of model files with a bounded number of imports in flight, reporting each model as soon as it is ready
+#include "AssimpBulkModelImporter.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/Paths.h"
+
+void UAssimpBulkModelImporter::ImportModels(const TArray<FString>& FilePaths, int32 InMaxInFlight, const FModelImportSettings& InDefaultSettings)
+{
+	check(IsInGameThread());
+
+	CancelAll();
+
+	PendingFiles = FilePaths;
+	DefaultSettings = InDefaultSettings;
+	NextFileIndex = 0;
+	NumInFlight = 0;
+	NumCompleted = 0;
+	MaxInFlight = InMaxInFlight > 0 ? InMaxInFlight : FMath::Max(1, FPlatformMisc::NumberOfWorkerThreadsToSpawn());
+
+	UE_LOG(LogTemp, Display, TEXT("🔹 Bulk import of %d models, %d in flight"), PendingFiles.Num(), MaxInFlight);
+
+	PumpQueue();
+
+	if (IsFinished())
+	{
+		OnAllModelsImported.Broadcast();
+	}
+}
+
+TArray<FModelImportTimings> UAssimpBulkModelImporter::GetImportTimings() const
+{
+	TArray<FModelImportTimings> Timings;
+	for (const UAssimpRuntime3DModelsImporter* Importer : Importers)
+	{
+		if (Importer && !Importer->IsImporting())
+		{
+			FModelImportTimings ImporterTimings = Importer->GetLastImportTimings();
+			if (!ImporterTimings.FilePath.IsEmpty())
+			{
+				Timings.Add(MoveTemp(ImporterTimings));
+			}
+		}
+	}
+	return Timings;
+}
+
+void UAssimpBulkModelImporter::CancelAll()
+{
+	for (UAssimpRuntime3DModelsImporter* Importer : Importers)
+	{
+		if (Importer)
+		{
+			Importer->OnImportCompleted.RemoveAll(this);
+			Importer->CancelImport();
+		}
+	}
+
+	Importers.Empty();
+	PendingFiles.Empty();
+	NextFileIndex = 0;
+	NumInFlight = 0;
+}
+
+void UAssimpBulkModelImporter::PumpQueue()
+{
+	while (NumInFlight < MaxInFlight && NextFileIndex < PendingFiles.Num())
+	{
+		const FString& Path = PendingFiles[NextFileIndex++];
+
+		UAssimpRuntime3DModelsImporter* Importer = NewObject<UAssimpRuntime3DModelsImporter>(this);
+		if (!Importer)
+		{
+			UE_LOG(LogTemp, Error, TEXT("❌ Failed to create importer for: %s"), *Path);
+			continue;
+		}
+
+		Importer->LoadAssimpDLLIfNeeded();
+		Importer->OnImportCompleted.AddUObject(this, &UAssimpBulkModelImporter::HandleModelImported);
+		Importers.Add(Importer);
+
+		const FModelImportSettings* Override = ModelSettingsOverrides.Find(FPaths::GetBaseFilename(Path));
+
+		++NumInFlight;
+		Importer->ImportModel(Path, Override ? *Override : DefaultSettings);
+	}
+}
+
+void UAssimpBulkModelImporter::HandleModelImported(UAssimpRuntime3DModelsImporter* Importer, bool bSuccess)
+{
+	--NumInFlight;
+	++NumCompleted;
+
+	// Start the next file before handing this one out, so spawning overlaps with the remaining imports
+	if (NextFileIndex < PendingFiles.Num())
+	{
+		PumpQueue();
+	}
+
+	OnModelImported.Broadcast(Importer, bSuccess);
+
+	if (IsFinished())
+	{
+		UE_LOG(LogTemp, Display, TEXT("✅ Bulk import finished: %d models"), NumCompleted);
+		OnAllModelsImported.Broadcast();
+	}
+}
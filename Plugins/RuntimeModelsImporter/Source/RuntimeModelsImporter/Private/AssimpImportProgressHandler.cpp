@@ -0,0 +1,27 @@
+// Assimp progress handler that forwards ReadFile/postprocess progress to the import task and aborts the read once the task is cancelled
+#include "AssimpImportProgressHandler.h"
+#include "AssimpRuntime3DModelsImporter.h"
+
+static float GetStepFraction(int CurrentStep, int NumberOfSteps)
+{
+	return NumberOfSteps > 0 ? FMath::Clamp(static_cast<float>(CurrentStep) / NumberOfSteps, 0.f, 1.f) : 0.f;
+}
+
+bool FAssimpImportProgressHandler::Update(float Percentage)
+{
+	// Loaders call this on their own with 0..1 for the whole read; only the cancel check matters here,
+	// the stage progress comes from UpdateFileRead/UpdatePostProcess
+	return !Task.IsCancelled();
+}
+
+void FAssimpImportProgressHandler::UpdateFileRead(int CurrentStep, int NumberOfSteps)
+{
+	Task.ReportProgress(EModelImportStage::Parsing, GetStepFraction(CurrentStep, NumberOfSteps));
+}
+
+void FAssimpImportProgressHandler::UpdatePostProcess(int CurrentStep, int NumberOfSteps)
+{
+	// Postprocess steps cannot be aborted from here (the hook returns void); ReadScene drops the scene
+	// right after ReadFile if the task was cancelled in the meantime
+	Task.ReportProgress(EModelImportStage::PostProcessing, GetStepFraction(CurrentStep, NumberOfSteps));
+}
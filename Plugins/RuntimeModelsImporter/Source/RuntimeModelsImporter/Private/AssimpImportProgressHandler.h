@@ -0,0 +1,21 @@
+// Assimp progress handler that forwards ReadFile/postprocess progress to the import task and aborts the read once the task is cancelled
+#pragma once
+#include "CoreMinimal.h"
+#include "assimp/ProgressHandler.hpp"
+
+struct FModelImportTask;
+
+class FAssimpImportProgressHandler : public Assimp::ProgressHandler
+{
+public:
+    explicit FAssimpImportProgressHandler(FModelImportTask& InTask) : Task(InTask) {}
+
+    // Returning false makes the loader give up and ReadFile return nullptr
+    virtual bool Update(float Percentage = -1.f) override;
+    // Progress only: the bundled Assimp declares these void and ignores them for aborting, the cancel check lives in Update
+    virtual void UpdateFileRead(int CurrentStep, int NumberOfSteps) override;
+    virtual void UpdatePostProcess(int CurrentStep, int NumberOfSteps) override;
+
+private:
+    FModelImportTask& Task;     // Outlives the handler: the importer drops it when it goes back to the pool
+};
@@ -0,0 +1,87 @@
+// Pool of reusable Assimp::Importer instances, so loader registration and postprocess-step setup are paid once per worker instead of once per import
+#include "AssimpImporterPool.h"
+#include "assimp/Importer.hpp"
+#include "assimp/IOSystem.hpp"
+#include "assimp/ProgressHandler.hpp"
+#include "HAL/PlatformMisc.h"
+#include "Misc/ScopeLock.h"
+
+void FAssimpImporterReleaser::operator()(Assimp::Importer* Importer) const
+{
+	FAssimpImporterPool::Get().Release(Importer);
+}
+
+FAssimpImporterPool& FAssimpImporterPool::Get()
+{
+	static FAssimpImporterPool Pool;
+	return Pool;
+}
+
+FPooledAssimpImporter FAssimpImporterPool::Acquire()
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (IdleImporters.Num() > 0)
+		{
+			return FPooledAssimpImporter(IdleImporters.Pop(EAllowShrinking::No));
+		}
+	}
+
+	return FPooledAssimpImporter(new Assimp::Importer());
+}
+
+void FAssimpImporterPool::Release(Assimp::Importer* Importer)
+{
+	if (!Importer)
+	{
+		return;
+	}
+
+	// Release the scene and everything it keeps mapped right away, not when the importer is next used
+	Importer->FreeScene();
+	if (!Importer->IsDefaultIOHandler())
+	{
+		// SetIOHandler(nullptr) hands the old handler back to us instead of deleting it
+		Assimp::IOSystem* IOHandler = Importer->GetIOHandler();
+		Importer->SetIOHandler(nullptr);
+		delete IOHandler;
+	}
+	if (!Importer->IsDefaultProgressHandler())
+	{
+		// Same hand-back as above; the handler points at an import task that is about to go away
+		Assimp::ProgressHandler* ProgressHandler = Importer->GetProgressHandler();
+		Importer->SetProgressHandler(nullptr);
+		delete ProgressHandler;
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (MaxIdleImporters == 0)
+		{
+			// One per worker thread that can be running an import, plus the GameThread
+			MaxIdleImporters = FMath::Max(1, FPlatformMisc::NumberOfWorkerThreadsToSpawn()) + 1;
+		}
+
+		if (IdleImporters.Num() < MaxIdleImporters)
+		{
+			IdleImporters.Push(Importer);
+			return;
+		}
+	}
+
+	delete Importer;
+}
+
+void FAssimpImporterPool::Empty()
+{
+	TArray<Assimp::Importer*> ToDelete;
+	{
+		FScopeLock ScopeLock(&Lock);
+		ToDelete = MoveTemp(IdleImporters);
+	}
+
+	for (Assimp::Importer* Importer : ToDelete)
+	{
+		delete Importer;
+	}
+}
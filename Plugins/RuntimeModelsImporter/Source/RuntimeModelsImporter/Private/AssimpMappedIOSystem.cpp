@@ -0,0 +1,151 @@
+// Assimp IOSystem that serves reads straight from memory-mapped file regions instead of fread-copied heap buffers
+#include "AssimpMappedIOSystem.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+TSharedPtr<FAssimpMappedFile> FAssimpMappedFile::Open(const FString& Path, bool bPreload)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const int64 FileSize = PlatformFile.FileSize(*Path);
+	if (FileSize < 0)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FAssimpMappedFile> File = MakeShareable(new FAssimpMappedFile());
+
+	if (FileSize > 0)
+	{
+		File->Handle.Reset(PlatformFile.OpenMapped(*Path));
+		if (File->Handle)
+		{
+			File->Region.Reset(File->Handle->MapRegion(0, FileSize, bPreload));
+		}
+	}
+
+	if (File->Region)
+	{
+		File->Data = File->Region->GetMappedPtr();
+		File->Size = File->Region->GetMappedSize();
+	}
+	else if (FileSize > 0)
+	{
+		// Platform file layer without mapping support (e.g. pak/network), read it the old way
+		File->Handle.Reset();
+		if (!FFileHelper::LoadFileToArray(File->FallbackData, *Path))
+		{
+			return nullptr;
+		}
+		File->Data = File->FallbackData.GetData();
+		File->Size = File->FallbackData.Num();
+	}
+
+	return File;
+}
+
+FAssimpMappedFile::~FAssimpMappedFile()
+{
+	Region.Reset();
+	Handle.Reset();
+}
+
+size_t FAssimpMappedIOStream::Read(void* pvBuffer, size_t pSize, size_t pCount)
+{
+	if (!pvBuffer || pSize == 0 || pCount == 0)
+	{
+		return 0;
+	}
+
+	const size_t Available = FileSize() - Position;
+	const size_t Count = FMath::Min(pCount, Available / pSize);
+	if (Count > 0)
+	{
+		FMemory::Memcpy(pvBuffer, File->GetData() + Position, Count * pSize);
+		Position += Count * pSize;
+	}
+	return Count;
+}
+
+aiReturn FAssimpMappedIOStream::Seek(size_t pOffset, aiOrigin pOrigin)
+{
+	size_t NewPosition = 0;
+	switch (pOrigin)
+	{
+	case aiOrigin_SET: NewPosition = pOffset; break;
+	case aiOrigin_CUR: NewPosition = Position + pOffset; break;
+	case aiOrigin_END: NewPosition = FileSize() - pOffset; break;
+	default: return aiReturn_FAILURE;
+	}
+
+	if (NewPosition > FileSize())
+	{
+		return aiReturn_FAILURE;
+	}
+
+	Position = NewPosition;
+	return aiReturn_SUCCESS;
+}
+
+bool FAssimpMappedIOSystem::Preload(const FString& Path)
+{
+	FString Key = Path;
+	FPaths::NormalizeFilename(Key);
+
+	TSharedPtr<FAssimpMappedFile> File = FAssimpMappedFile::Open(Key, true);
+	if (!File.IsValid())
+	{
+		return false;
+	}
+
+	OpenFiles.Add(Key, File);
+	return true;
+}
+
+TSharedPtr<FAssimpMappedFile> FAssimpMappedIOSystem::MapFile(const FString& Path)
+{
+	FString Key = Path;
+	FPaths::NormalizeFilename(Key);
+
+	if (const TSharedPtr<FAssimpMappedFile>* Existing = OpenFiles.Find(Key))
+	{
+		return *Existing;
+	}
+
+	TSharedPtr<FAssimpMappedFile> File = FAssimpMappedFile::Open(Key);
+	if (File.IsValid())
+	{
+		OpenFiles.Add(Key, File);
+	}
+	return File;
+}
+
+bool FAssimpMappedIOSystem::Exists(const char* pFile) const
+{
+	FString Path = UTF8_TO_TCHAR(pFile);
+	FPaths::NormalizeFilename(Path);
+	return OpenFiles.Contains(Path) || FPaths::FileExists(Path);
+}
+
+Assimp::IOStream* FAssimpMappedIOSystem::Open(const char* pFile, const char* pMode)
+{
+	// Import only ever reads; refuse write/append modes instead of silently mapping
+	if (!pFile || (pMode && (FCStringAnsi::Strchr(pMode, 'w') || FCStringAnsi::Strchr(pMode, 'a') || FCStringAnsi::Strchr(pMode, '+'))))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FAssimpMappedFile> File = MapFile(UTF8_TO_TCHAR(pFile));
+	if (!File.IsValid())
+	{
+		return nullptr;
+	}
+
+	return new FAssimpMappedIOStream(MoveTemp(File));
+}
+
+void FAssimpMappedIOSystem::Close(Assimp::IOStream* pFile)
+{
+	delete pFile;
+}
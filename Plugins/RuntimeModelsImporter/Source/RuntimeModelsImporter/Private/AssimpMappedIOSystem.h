@@ -0,0 +1,65 @@
+// Assimp IOSystem that serves reads straight from memory-mapped file regions instead of fread-copied heap buffers
+#pragma once
+#include "CoreMinimal.h"
+#include "assimp/IOSystem.hpp"
+#include "assimp/IOStream.hpp"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// --- Read-only view of one whole file, mapped when the platform allows it and heap-loaded otherwise
+class FAssimpMappedFile
+{
+public:
+    static TSharedPtr<FAssimpMappedFile> Open(const FString& Path, bool bPreload = false);
+    ~FAssimpMappedFile();
+
+    const uint8* GetData() const { return Data; }
+    int64 GetSize() const { return Size; }
+    bool IsMapped() const { return Region.IsValid(); }
+
+private:
+    FAssimpMappedFile() = default;
+
+    TUniquePtr<IMappedFileHandle> Handle;
+    TUniquePtr<IMappedFileRegion> Region;   // Declared after Handle so it is unmapped first
+    TArray64<uint8> FallbackData;
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+};
+
+// --- Stream over a mapped file; Read is a memcpy out of the mapping, Seek/Tell are pointer math
+class FAssimpMappedIOStream : public Assimp::IOStream
+{
+public:
+    explicit FAssimpMappedIOStream(TSharedPtr<FAssimpMappedFile> InFile) : File(MoveTemp(InFile)) {}
+
+    virtual size_t Read(void* pvBuffer, size_t pSize, size_t pCount) override;
+    virtual size_t Write(const void* pvBuffer, size_t pSize, size_t pCount) override { return 0; }
+    virtual aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override;
+    virtual size_t Tell() const override { return Position; }
+    virtual size_t FileSize() const override { return static_cast<size_t>(File->GetSize()); }
+    virtual void Flush() override {}
+
+private:
+    TSharedPtr<FAssimpMappedFile> File;
+    size_t Position = 0;
+};
+
+// --- Read-only IOSystem; the importer that owns it is only ever used from one thread at a time
+class FAssimpMappedIOSystem : public Assimp::IOSystem
+{
+public:
+    // Maps a file ahead of ReadFile so the page-in happens in the file I/O stage, not inside the loader
+    bool Preload(const FString& Path);
+    // Mapped view of any file (model, sidecar or texture), shared with earlier opens of the same path
+    TSharedPtr<FAssimpMappedFile> MapFile(const FString& Path);
+
+    virtual bool Exists(const char* pFile) const override;
+    virtual char getOsSeparator() const override { return '/'; }
+    virtual Assimp::IOStream* Open(const char* pFile, const char* pMode = "rb") override;
+    virtual void Close(Assimp::IOStream* pFile) override;
+
+private:
+    TMap<FString, TSharedPtr<FAssimpMappedFile>> OpenFiles;
+};
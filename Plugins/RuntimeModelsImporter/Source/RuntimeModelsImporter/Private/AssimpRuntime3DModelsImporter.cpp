@@ -1,5 +1,25 @@
 ﻿// Class Added by Ebaad, This class deals with Model Raw Data Extraction using Assimp , Creating Model From that Data and Spawning on Demand in Scene On Certain Location
 #include "AssimpRuntime3DModelsImporter.h"
+#include "AssimpMappedIOSystem.h"
+#include "AssimpImportProgressHandler.h"
+#include "ModelImportCache.h"
+#include "ModelImportProfiler.h"
+#include "ModelVertexStreams.h"
+#include "ModelTangentGenerator.h"
+#include "ModelMeshOptimizer.h"
+#include "ModelMeshSimplifier.h"
+#include "ModelMeshChunker.h"
+#include "ModelVertexWelder.h"
+#include "ModelNormalGenerator.h"
+#include "ModelStaticMeshBuilder.h"
+#include "ModelTextureDecoder.h"
+#include "ModelGameThreadScheduler.h"
+#include "ModelTemplate.h"
+#include "ModelCollisionBuilder.h"
+#include "ModelConvexDecomposer.h"
+#include "ModelCollisionCache.h"
+#include "MeshDescription.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "ProceduralMeshComponent.h"
 #include "Engine/World.h"
 #include "StaticMeshAttributes.h"
@@ -8,166 +28,1229 @@
 #include "UObject/Package.h"
 #include "Engine/StaticMeshActor.h"
 #include "PhysicsEngine/BodySetup.h"
-#include "IImageWrapperModule.h"
-#include "IImageWrapper.h"
-#include "Modules/ModuleManager.h"
 #include "Misc/FileHelper.h"
 #include "Materials/MaterialInstanceDynamic.h"
-#include "Windows/AllowWindowsPlatformTypes.h"
-#include "DirectXTex.h"
-#include "Windows/HideWindowsPlatformTypes.h"
 #include "Kismet/GameplayStatics.h"
-#include <KismetProceduralMeshLibrary.h>
+#include "Async/Async.h"
+#include "Tasks/Task.h"
+#include "Async/ParallelFor.h"
 
 UAssimpRuntime3DModelsImporter::UAssimpRuntime3DModelsImporter() {
 }
 
-void UAssimpRuntime3DModelsImporter::ParseNode(aiNode* Node, const aiScene* Scene, FModelNodeData& OutNode, const FString& FbxFilePath) {
+void UAssimpRuntime3DModelsImporter::BeginDestroy()
+{
+	CancelImport();
+	Super::BeginDestroy();
+}
+
+const TCHAR* GetModelImportStageName(EModelImportStage Stage)
+{
+	switch (Stage)
+	{
+	case EModelImportStage::Reading:        return TEXT("Reading");
+	case EModelImportStage::LoadingCache:   return TEXT("LoadingCache");
+	case EModelImportStage::Parsing:        return TEXT("Parsing");
+	case EModelImportStage::PostProcessing: return TEXT("PostProcessing");
+	case EModelImportStage::Extracting:     return TEXT("Extracting");
+	case EModelImportStage::Committing:     return TEXT("Committing");
+	default:                                return TEXT("Unknown");
+	}
+}
+
+// Slice of the overall 0..1 range owned by each stage, roughly proportional to where time goes on a cold import
+static void GetStageRange(EModelImportStage Stage, float& OutStart, float& OutEnd)
+{
+	switch (Stage)
+	{
+	case EModelImportStage::Reading:        OutStart = 0.00f; OutEnd = 0.05f; break;
+	case EModelImportStage::LoadingCache:   OutStart = 0.05f; OutEnd = 0.90f; break;
+	case EModelImportStage::Parsing:        OutStart = 0.05f; OutEnd = 0.40f; break;
+	case EModelImportStage::PostProcessing: OutStart = 0.40f; OutEnd = 0.65f; break;
+	case EModelImportStage::Extracting:     OutStart = 0.65f; OutEnd = 0.90f; break;
+	case EModelImportStage::Committing:
+	default:                                OutStart = 0.90f; OutEnd = 1.00f; break;
+	}
+}
+
+void FModelImportTask::ReportProgress(EModelImportStage Stage, float StageFraction)
+{
+	if (!OnProgress || IsCancelled())
+	{
+		return;
+	}
+
+	float Start, End;
+	GetStageRange(Stage, Start, End);
+	const float Progress = FMath::Lerp(Start, End, FMath::Clamp(StageFraction, 0.f, 1.f));
+	const int32 Permille = FMath::FloorToInt32(Progress * 1000.f);
+
+	// Every report is a GameThread hop, so only forward stage changes and moves of at least 1%. Reports race in from
+	// parallel extraction, so the permille only ever moves up: a report that lost the race is dropped, never published
+	const uint8 PreviousStage = LastReportedStage.exchange(static_cast<uint8>(Stage));
+	int32 PreviousPermille = LastReportedPermille.load();
+	do
+	{
+		if (Permille <= PreviousPermille || (PreviousStage == static_cast<uint8>(Stage) && Permille < PreviousPermille + 10))
+		{
+			return;
+		}
+	} while (!LastReportedPermille.compare_exchange_weak(PreviousPermille, Permille));
+
+	OnProgress(Progress, Stage);
+}
+
+void FModelImportTask::ReleaseScene()
+{
+	Scene = nullptr;
+	IOSystem = nullptr;
+	Importer.Reset(); // Back to the pool, which frees the aiScene and unmaps every file (FreeScene + IO handler reset)
+}
+
+static void DecodeProcMeshStreams(const FModelMeshData& Section, TArray<FVector>& OutVertices, TArray<FVector>& OutNormals, TArray<FVector2D>& OutUVs, TArray<FProcMeshTangent>& OutTangents)
+{
+	const int32 NumVertices = Section.GetNumVertices();
+
+	OutVertices.SetNumUninitialized(NumVertices);
+	for (int32 i = 0; i < NumVertices; ++i)
+	{
+		OutVertices[i] = FVector(Section.GetPosition(i));
+	}
+
+	if (Section.HasStream(EModelMeshStreams::Normals))
+	{
+		OutNormals.SetNumUninitialized(NumVertices);
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			OutNormals[i] = FVector(Section.GetNormal(i));
+		}
+	}
+
+	if (Section.HasStream(EModelMeshStreams::UVs))
+	{
+		OutUVs.SetNumUninitialized(NumVertices);
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			OutUVs[i] = FVector2D(Section.GetUV(i));
+		}
+	}
+
+	if (Section.HasStream(EModelMeshStreams::Tangents))
+	{
+		OutTangents.SetNumUninitialized(NumVertices);
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			const FModelTangentFrame Frame = Section.GetTangent(i);
+			OutTangents[i] = FProcMeshTangent(FVector(Frame.Tangent), Frame.BitangentSign < 0.f);
+		}
+	}
+}
+
+void UAssimpRuntime3DModelsImporter::ParseNode(aiNode* Node, const aiScene* Scene, FModelNodeData& OutNode, FModelImportTask& Task) {
 	OutNode.Name = UTF8_TO_TCHAR(Node->mName.C_Str());
 	OutNode.Transform = ConvertAssimpMatrix(Node->mTransformation);
+
+	// Meshes were extracted once up front; every node referencing one shares it
 	for (uint32 i = 0; i < Node->mNumMeshes; ++i) {
-		aiMesh* Mesh = Scene->mMeshes[Node->mMeshes[i]];
-		FModelMeshData MeshData;
-		ExtractMesh(Mesh, Scene, MeshData, FbxFilePath);
-		OutNode.MeshSections.Add(MoveTemp(MeshData));
+		OutNode.MeshSections.Append(Task.Meshes[Node->mMeshes[i]]);
+	}
+
+	for (uint32 i = 0; i < Node->mNumChildren; ++i) {
+		if (Task.IsCancelled()) return;
+
+		FModelNodeData ChildNode;
+		ParseNode(Node->mChildren[i], Scene, ChildNode, Task);
+		OutNode.Children.Add(MoveTemp(ChildNode));
+	}
+}
+
+void UAssimpRuntime3DModelsImporter::CollectReferencedMeshes(const aiNode* Node, TBitArray<>& OutReferenced)
+{
+	for (uint32 i = 0; i < Node->mNumMeshes; ++i)
+	{
+		if (OutReferenced.IsValidIndex(Node->mMeshes[i]))
+		{
+			OutReferenced[Node->mMeshes[i]] = true;
+		}
+	}
+	for (uint32 i = 0; i < Node->mNumChildren; ++i)
+	{
+		CollectReferencedMeshes(Node->mChildren[i], OutReferenced);
+	}
+}
+
+void UAssimpRuntime3DModelsImporter::ExtractMeshes(FModelImportTask& Task)
+{
+	const aiScene* Scene = Task.Scene;
+
+	// Only meshes some node references; one extraction each no matter how many nodes instance it
+	TBitArray<> Referenced(false, Scene->mNumMeshes);
+	CollectReferencedMeshes(Scene->mRootNode, Referenced);
+
+	TArray<int32> MeshIndices;
+	for (TConstSetBitIterator<> It(Referenced); It; ++It)
+	{
+		MeshIndices.Add(It.GetIndex());
+	}
+
+	Task.Meshes.SetNum(Scene->mNumMeshes);
+	Task.NumMeshesToExtract = MeshIndices.Num();
+	Task.NumMeshesExtracted = 0;
+	Task.ReportProgress(EModelImportStage::Extracting, 0.f);
+
+	// Meshes are independent, so they go wide; each body writes only its own slot of Task.Meshes.
+	// Stage times recorded from these threads add up CPU time, not wall time
+	FModelImportProfiler* Profiler = Task.Profiler.Get();
+	ParallelFor(MeshIndices.Num(), [&Task, &MeshIndices, Scene, Profiler](int32 i)
+		{
+			// Checked per mesh so a cancel during a large extraction stops within one mesh per worker
+			if (Task.IsCancelled()) return;
+
+			FModelImportProfiler::FScopedContext ProfilerContext(Profiler);
+			const int32 MeshIndex = MeshIndices[i];
+			ExtractMesh(Scene->mMeshes[MeshIndex], Scene, Task.Meshes[MeshIndex], Task.Settings);
+
+			const int32 NumExtracted = ++Task.NumMeshesExtracted;
+			Task.ReportProgress(EModelImportStage::Extracting, static_cast<float>(NumExtracted) / FMath::Max(1, Task.NumMeshesToExtract));
+		});
+}
+
+void UAssimpRuntime3DModelsImporter::ExtractMesh(aiMesh* Mesh, const aiScene* Scene, TArray<TSharedPtr<FModelMeshData>>& OutSections, const FModelImportSettings& Settings)
+{
+	MODEL_IMPORT_SCOPE(ExtractMesh);
+
+	TSharedPtr<FModelMeshData> MeshData = MakeShared<FModelMeshData>();
+	FModelMeshData& OutMesh = *MeshData;
+	if (Settings.bParallelWeldAndNormals)
+	{
+		ExtractWeldedMesh(Mesh, OutMesh, Settings);
+	}
+	else
+	{
+		const int32 NumVertices = static_cast<int32>(Mesh->mNumVertices);
+		const int32 NumFaces = static_cast<int32>(Mesh->mNumFaces);
+
+		// --- One allocation for every stream the mesh actually has ---
+		EModelMeshStreams Streams = EModelMeshStreams::None;
+		if (Mesh->HasNormals()) Streams |= EModelMeshStreams::Normals;
+		if (Settings.bImportUVs && Mesh->HasTextureCoords(0)) Streams |= EModelMeshStreams::UVs;
+		if (Settings.bComputeTangents) Streams |= EModelMeshStreams::Tangents;
+		OutMesh.Allocate(NumVertices, NumFaces * 3, Streams);
+
+		// --- Vertices, Normals, UVs (each stream converted in one pass) ---
+		FModelVertexStreams::ConvertVectors(Mesh->mVertices, OutMesh.GetPositions());
+		if (OutMesh.HasStream(EModelMeshStreams::Normals))
+			FModelVertexStreams::ConvertVectors(Mesh->mNormals, OutMesh.GetNormals());
+		if (OutMesh.HasStream(EModelMeshStreams::UVs))
+			FModelVertexStreams::ConvertUVs(Mesh->mTextureCoords[0], OutMesh.GetUVs());
+
+		// --- Triangles ---
+		OutMesh.ShrinkIndices(FModelVertexStreams::ConvertTriangles(Mesh->mFaces, NumFaces, OutMesh.GetIndices()));
+
+		// --- Tangents (Assimp's when present, generated otherwise; needs the triangles, so runs after them) ---
+		FModelTangentGenerator::BuildTangents(Mesh, OutMesh);
+	}
+
+	// --- Material assignment (material instances are created on the GameThread commit) ---
+	if (Mesh->mMaterialIndex < Scene->mNumMaterials && Scene->mMaterials[Mesh->mMaterialIndex])
+	{
+		OutMesh.MaterialIndex = static_cast<int32>(Mesh->mMaterialIndex);
+	}
+
+	// --- Spatial chunks: each becomes its own section with its own bounds, and is finished independently ---
+	if (Settings.SpatialChunkVertices > 0 && OutMesh.GetNumVertices() > Settings.SpatialChunkVertices)
+	{
+		OutSections = FModelMeshChunker::Split(OutMesh, Settings.SpatialChunkVertices);
+		MeshData.Reset();
+
+		FModelImportProfiler* Profiler = FModelImportProfiler::GetCurrent();
+		ParallelFor(OutSections.Num(), [&OutSections, Mesh, &Settings, Profiler](int32 i)
+			{
+				FModelImportProfiler::FScopedContext ProfilerContext(Profiler);
+				FinishMeshSection(Mesh, *OutSections[i], Settings);
+			});
+		UE_LOG(LogTemp, Verbose, TEXT("🔹 Mesh '%s' split into %d spatial chunks"), UTF8_TO_TCHAR(Mesh->mName.C_Str()), OutSections.Num());
+	}
+	else
+	{
+		FinishMeshSection(Mesh, OutMesh, Settings);
+		OutSections.Add(MoveTemp(MeshData));
+	}
+}
+
+void UAssimpRuntime3DModelsImporter::FinishMeshSection(const aiMesh* Mesh, FModelMeshData& OutMesh, const FModelImportSettings& Settings)
+{
+	// --- Vertex cache / overdraw / fetch order, on the final buffers (Assimp's own reordering ran before faces were filtered) ---
+	if (Settings.bOptimizeVertexCache)
+	{
+		const bool bLogACMR = UE_LOG_ACTIVE(LogTemp, VeryVerbose);
+		const float ACMRBefore = bLogACMR ? FModelMeshOptimizer::ComputeACMR(OutMesh.GetIndices(), OutMesh.GetNumVertices()) : 0.f;
+		FModelMeshOptimizer::OptimizeMesh(OutMesh, Settings.bOptimizeOverdraw);
+		if (bLogACMR)
+		{
+			UE_LOG(LogTemp, VeryVerbose, TEXT("🔹 Mesh '%s' ACMR %.3f -> %.3f"), UTF8_TO_TCHAR(Mesh->mName.C_Str()),
+				ACMRBefore, FModelMeshOptimizer::ComputeACMR(OutMesh.GetIndices(), OutMesh.GetNumVertices()));
+		}
+	}
+
+	// --- LOD chain over the same vertices, each level reordered for the vertex cache like LOD0 ---
+	if (Settings.NumLODs > 1)
+	{
+		FModelMeshSimplifier::BuildLODs(OutMesh, FMath::Min(Settings.NumLODs, MAX_STATIC_MESH_LODS), Settings.LODReductionRatio);
+		if (Settings.bOptimizeVertexCache)
+		{
+			for (TArray<int32>& LOD : OutMesh.LODIndices)
+			{
+				FModelMeshOptimizer::OptimizeVertexCache(LOD, OutMesh.GetNumVertices());
+			}
+		}
+	}
+
+	// --- Optional quantized storage, last so every step above works on float streams ---
+	if (Settings.bQuantizeVertices)
+	{
+		OutMesh.Quantize(Settings.bQuantizePositions);
+	}
+}
+
+void UAssimpRuntime3DModelsImporter::ExtractWeldedMesh(const aiMesh* Mesh, FModelMeshData& OutMesh, const FModelImportSettings& Settings)
+{
+	const int32 NumVertices = static_cast<int32>(Mesh->mNumVertices);
+	const int32 NumFaces = static_cast<int32>(Mesh->mNumFaces);
+
+	// --- Convert into growable streams; ReadFile skipped JoinIdenticalVertices, so these are still per-corner ---
+	FModelWeldStreams Streams;
+	Streams.Positions.SetNumUninitialized(NumVertices);
+	FModelVertexStreams::ConvertVectors(Mesh->mVertices, Streams.Positions);
+	if (Mesh->HasNormals() && !Settings.bRecomputeNormals)
+	{
+		Streams.Normals.SetNumUninitialized(NumVertices);
+		FModelVertexStreams::ConvertVectors(Mesh->mNormals, Streams.Normals);
+	}
+	if (Settings.bImportUVs && Mesh->HasTextureCoords(0))
+	{
+		Streams.UVs.SetNumUninitialized(NumVertices);
+		FModelVertexStreams::ConvertUVs(Mesh->mTextureCoords[0], Streams.UVs);
+	}
+	Streams.Indices.SetNumUninitialized(NumFaces * 3);
+	Streams.Indices.SetNum(FModelVertexStreams::ConvertTriangles(Mesh->mFaces, NumFaces, Streams.Indices), EAllowShrinking::No);
+
+	// --- Weld, then fill in normals where the file had none (source normals are kept, as GenNormals would) ---
+	FModelVertexWelder::Weld(Streams, Settings.WeldTolerance);
+	if (Streams.Normals.IsEmpty())
+	{
+		FModelNormalGenerator::GenerateNormals(Streams, Settings.NormalCreaseAngle);
+	}
+
+	// --- Same single allocation as the unwelded path ---
+	EModelMeshStreams MeshStreams = EModelMeshStreams::Normals;
+	if (!Streams.UVs.IsEmpty()) MeshStreams |= EModelMeshStreams::UVs;
+	if (Settings.bComputeTangents) MeshStreams |= EModelMeshStreams::Tangents;
+	OutMesh.Allocate(Streams.Positions.Num(), Streams.Indices.Num(), MeshStreams);
+	FMemory::Memcpy(OutMesh.GetPositions().GetData(), Streams.Positions.GetData(), Streams.Positions.NumBytes());
+	FMemory::Memcpy(OutMesh.GetNormals().GetData(), Streams.Normals.GetData(), Streams.Normals.NumBytes());
+	if (OutMesh.HasStream(EModelMeshStreams::UVs))
+	{
+		FMemory::Memcpy(OutMesh.GetUVs().GetData(), Streams.UVs.GetData(), Streams.UVs.NumBytes());
+	}
+	FMemory::Memcpy(OutMesh.GetIndices().GetData(), Streams.Indices.GetData(), Streams.Indices.NumBytes());
+
+	// --- Tangents always come from our generator here: Assimp's were per source vertex, not per welded vertex ---
+	if (OutMesh.HasStream(EModelMeshStreams::Tangents))
+	{
+		FModelTangentGenerator::GenerateTangents(OutMesh);
+	}
+}
+
+bool UAssimpRuntime3DModelsImporter::BuildMeshDescriptions(FModelImportTask& Task)
+{
+	const FModelImportSettings& Settings = Task.Settings;
+	const bool bStaticMeshBackend = Settings.SpawnBackend == EModelSpawnBackend::StaticMesh || Settings.bPrepareModelTemplate;
+	if (!bStaticMeshBackend && !Settings.bInstanceRepeatedMeshes)
+	{
+		return !Task.IsCancelled();
+	}
+
+	MODEL_IMPORT_SCOPE(BuildMeshDescription);
+
+	// Same selection SpawnModel makes: every section for the static mesh backend (or a model template), otherwise only the instanced ones
+	TMap<const FModelMeshData*, int32> ReferenceCounts;
+	CountSectionReferences(Task.RootNode, ReferenceCounts);
+
+	TArray<const FModelMeshData*> Sections;
+	for (const TPair<const FModelMeshData*, int32>& Pair : ReferenceCounts)
+	{
+		if (bStaticMeshBackend || Pair.Value >= FMath::Max(2, Settings.MinInstanceCount))
+		{
+			Sections.Add(Pair.Key);
+		}
+	}
+
+	TArray<TSharedPtr<TArray<FMeshDescription>>> Descriptions;
+	Descriptions.SetNum(Sections.Num());
+	FModelImportProfiler* Profiler = Task.Profiler.Get();
+	ParallelFor(Sections.Num(), [&Task, &Sections, &Descriptions, Profiler](int32 i)
+		{
+			if (Task.IsCancelled()) return;
+
+			FModelImportProfiler::FScopedContext ProfilerContext(Profiler);
+			const FModelMeshData& Section = *Sections[i];
+			Descriptions[i] = MakeShared<TArray<FMeshDescription>>();
+			Descriptions[i]->SetNum(Section.GetNumLODs());
+			for (int32 LODIndex = 0; LODIndex < Section.GetNumLODs(); ++LODIndex)
+			{
+				FModelStaticMeshBuilder::BuildMeshDescription(Section, (*Descriptions[i])[LODIndex], LODIndex);
+			}
+		});
+
+	if (Task.IsCancelled()) return false;
+
+	for (int32 i = 0; i < Sections.Num(); ++i)
+	{
+		Task.MeshDescriptions.Add(Sections[i], MoveTemp(Descriptions[i]));
+	}
+	return true;
+}
+
+bool UAssimpRuntime3DModelsImporter::BuildCollisionHulls(FModelImportTask& Task)
+{
+	if (Task.Settings.CollisionMode != EModelCollisionMode::SimplifiedConvex)
+	{
+		return !Task.IsCancelled();
+	}
+
+	// Every referenced section, whichever backend ends up drawing it
+	TMap<const FModelMeshData*, int32> ReferenceCounts;
+	CountSectionReferences(Task.RootNode, ReferenceCounts);
+	TArray<const FModelMeshData*> Sections;
+	ReferenceCounts.GetKeys(Sections);
+
+	TArray<TArray<FVector>> Hulls;
+	Hulls.SetNum(Sections.Num());
+	FModelImportProfiler* Profiler = Task.Profiler.Get();
+	ParallelFor(Sections.Num(), [&Task, &Sections, &Hulls, Profiler](int32 i)
+		{
+			if (Task.IsCancelled()) return;
+
+			FModelImportProfiler::FScopedContext ProfilerContext(Profiler);
+			FModelCollisionBuilder::BuildConvexHullPoints(*Sections[i], Hulls[i]);
+		});
+
+	if (Task.IsCancelled()) return false;
+
+	for (int32 i = 0; i < Sections.Num(); ++i)
+	{
+		Task.CollisionHulls.Add(Sections[i], MoveTemp(Hulls[i]));
+	}
+	return true;
+}
+
+static FModelConvexDecomposer::FParams GetDecompositionParams(const FModelImportSettings& Settings)
+{
+	FModelConvexDecomposer::FParams Params;
+	Params.MaxHulls = Settings.MaxConvexHulls;
+	Params.Resolution = Settings.DecompositionResolution;
+	Params.MaxConcavity = Settings.DecompositionConcavity;
+	return Params;
+}
+
+bool UAssimpRuntime3DModelsImporter::DecomposeCollision(FModelImportTask& Task)
+{
+	if (Task.Settings.CollisionMode != EModelCollisionMode::ConvexDecomposition)
+	{
+		return !Task.IsCancelled();
+	}
+
+	// The persisted decomposition replaces the whole stage; its key covers the extraction settings the sections came from
+	TArray<const FModelMeshData*> Sections;
+	FModelCollisionCache::CollectSections(Task.RootNode, Sections);
+	const uint64 CollisionKey = Task.Settings.GetCollisionKey();
+	if (Task.Settings.bUseModelCache && FModelCollisionCache::Load(Task.FilePath, Task.SourceHash, CollisionKey, Sections, Task.ConvexDecompositions))
+	{
+		return !Task.IsCancelled();
+	}
+
+	TArray<TArray<TArray<FVector>>> Hulls;
+	Hulls.SetNum(Sections.Num());
+	const FModelConvexDecomposer::FParams Params = GetDecompositionParams(Task.Settings);
+	FModelImportProfiler* Profiler = Task.Profiler.Get();
+	ParallelFor(Sections.Num(), [&Task, &Sections, &Hulls, &Params, Profiler](int32 i)
+		{
+			if (Task.IsCancelled()) return;
+
+			FModelImportProfiler::FScopedContext ProfilerContext(Profiler);
+			FModelConvexDecomposer::Decompose(*Sections[i], Params, Hulls[i]);
+		});
+
+	if (Task.IsCancelled()) return false;
+
+	int32 NumHulls = 0;
+	for (int32 i = 0; i < Sections.Num(); ++i)
+	{
+		NumHulls += Hulls[i].Num();
+		Task.ConvexDecompositions.Add(Sections[i], MoveTemp(Hulls[i]));
+	}
+	UE_LOG(LogTemp, Log, TEXT("🔹 Decomposed %d sections into %d convex hulls: %s"), Sections.Num(), NumHulls, *Task.FilePath);
+
+	if (Task.Settings.bUseModelCache)
+	{
+		FModelCollisionCache::Save(Task.FilePath, Task.SourceHash, CollisionKey, Sections, Task.ConvexDecompositions);
+	}
+	return true;
+}
+
+// Per-SpawnModel state: which sections are rendered instanced, and the model-space transforms gathered for them
+struct FModelSpawnContext
+{
+	int32 MinInstanceCount = MAX_int32;
+	TMap<const FModelMeshData*, int32> ReferenceCounts;
+	TMap<const FModelMeshData*, TArray<FTransform>> InstanceTransforms;
+	TArray<USceneComponent*> PendingRegistration; // Created and set up, not registered yet; parents before children
+
+	void RegisterPendingComponents()
+	{
+		for (USceneComponent* Component : PendingRegistration)
+		{
+			Component->RegisterComponent();
+		}
+		PendingRegistration.Reset();
+	}
+
+	bool IsInstanced(const FModelMeshData* Section) const
+	{
+		const int32* Count = ReferenceCounts.Find(Section);
+		return Count && *Count >= MinInstanceCount;
+	}
+};
+
+AActor* UAssimpRuntime3DModelsImporter::SpawnRootActor(UWorld* World, const FTransform& modelTransform)
+{
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Invalid world context in SpawnModel"));
+		return nullptr;
+	}
+
+	// Spawn the root container actor
+	AActor* RootActor = World->SpawnActor<AActor>(AActor::StaticClass(), modelTransform);
+
+	if (!RootActor)
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Failed to spawn RootActor"));
+		return nullptr;
+	}
+	else
+	{
+		RootFBXActor = RootActor;
+
+	}
+
+#if WITH_EDITOR
+	RootActor->SetActorLabel(ModelName);
+#endif
+
+	// Add root scene component
+	USceneComponent* RootComp = NewObject<USceneComponent>(RootActor);
+	if (!RootComp)
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Failed to create RootComponent"));
+		RootActor->Destroy();
+		return nullptr;
+	}
+
+	RootComp->RegisterComponent();
+	RootActor->SetRootComponent(RootComp);
+	RootActor->SetActorTransform(FTransform(modelTransform));
+	return RootActor;
+}
+
+void UAssimpRuntime3DModelsImporter::InitSpawnContext(FModelSpawnContext& Context) const
+{
+	if (ImportSettings.bInstanceRepeatedMeshes)
+	{
+		Context.MinInstanceCount = FMath::Max(2, ImportSettings.MinInstanceCount);
+		CountSectionReferences(RootNode, Context.ReferenceCounts);
+	}
+}
+
+AActor* UAssimpRuntime3DModelsImporter::SpawnModel(UWorld* World, const FTransform& modelTransform)
+{
+	AActor* RootActor = SpawnRootActor(World, modelTransform);
+	if (!RootActor)
+	{
+		return nullptr;
 	}
 
-	for (uint32 i = 0; i < Node->mNumChildren; ++i) {
-		FModelNodeData ChildNode;
-		ParseNode(Node->mChildren[i], Scene, ChildNode, FbxFilePath);
-		OutNode.Children.Add(MoveTemp(ChildNode));
+	// ✅ Spawn the entire hierarchy starting from the real RootNode
+	{
+		FModelImportProfiler::FScopedContext ProfilerContext(LastImportProfiler.Get());
+		MODEL_IMPORT_SCOPE(SpawnNodeRecursive);
+
+		FModelSpawnContext Context;
+		InitSpawnContext(Context);
+
+		if (ImportSettings.SpawnHierarchy == EModelSpawnHierarchy::ComponentPerNode)
+		{
+			// Whole hierarchy on RootActor, registered in one pass once every component is set up
+			SpawnNodeComponentsRecursive(RootNode, RootActor, RootActor->GetRootComponent(), FTransform::Identity, Context);
+			Context.RegisterPendingComponents();
+		}
+		else
+		{
+			SpawnNodeRecursive(World, RootNode, RootActor, FTransform::Identity, Context);
+		}
+		SpawnInstancedSections(RootActor, Context);
+	}
+
+	// ✅ Optional debug log
+	UE_LOG(LogTemp, Log, TEXT("✅ Spawned model '%s' with %d nodes"), *ModelName, SpawnedNodeComponents.Num());
+
+	// Uncomment to list all spawned nodes
+	/*
+	for (const auto& Pair : SpawnedNodeActors)
+	{
+		UE_LOG(LogTemp, Log, TEXT("   - Spawned NodeActor: %s"), *Pair.Key);
+	}
+	*/
+
+	return RootActor;
+}
+
+TFuture<AActor*> UAssimpRuntime3DModelsImporter::SpawnModelAsync(UWorld* World, const FTransform& modelTransform, EModelWorkPriority Priority)
+{
+	check(IsInGameThread());
+
+	// Everything one SpawnModelAsync call carries from step to step
+	struct FAsyncSpawn
+	{
+		struct FStep
+		{
+			const FModelNodeData* Node;
+			int32 Parent;               // Step of the parent node; INDEX_NONE for the model root
+			FTransform ModelTransform;
+		};
+
+		TWeakObjectPtr<AActor> RootActor;
+		TWeakObjectPtr<UWorld> World;
+		FModelSpawnContext Context;
+		TArray<FStep> Steps;                                        // Breadth-first, so parents always come before their children
+		TArray<TWeakObjectPtr<USceneComponent>> NodeComponents;    // Per finished step; null where the node failed
+		TArray<const FModelMeshData*> InstancedSections;
+		int32 NextInstanced = 0;
+		int32 CommitSerial = 0;
+		TPromise<AActor*> Promise;
+	};
+
+	TSharedRef<FAsyncSpawn> Spawn = MakeShared<FAsyncSpawn>();
+	TFuture<AActor*> Future = Spawn->Promise.GetFuture();
+
+	// The root actor goes in right away, so the caller can place or hide it while the nodes stream in
+	AActor* RootActor = SpawnRootActor(World, modelTransform);
+	if (!RootActor)
+	{
+		Spawn->Promise.SetValue(nullptr);
+		return Future;
+	}
+
+	Spawn->RootActor = RootActor;
+	Spawn->World = World;
+	Spawn->CommitSerial = CommitSerial;
+	InitSpawnContext(Spawn->Context);
+
+	// Steps point into RootNode; CommitSerial tells them when a newer import has replaced it
+	Spawn->Steps.Add({ &RootNode, INDEX_NONE, RootNode.Transform });
+	for (int32 StepIndex = 0; StepIndex < Spawn->Steps.Num(); ++StepIndex)
+	{
+		for (const FModelNodeData& Child : Spawn->Steps[StepIndex].Node->Children)
+		{
+			Spawn->Steps.Add({ &Child, StepIndex, Child.Transform * Spawn->Steps[StepIndex].ModelTransform });
+		}
+	}
+
+	// One node (or one instanced section) per step, so the scheduler can stop between any two of them
+	TWeakObjectPtr<UAssimpRuntime3DModelsImporter> WeakThis(this);
+	FModelGameThreadScheduler::Get().Enqueue(Priority, [WeakThis, Spawn]()
+		{
+			UAssimpRuntime3DModelsImporter* Importer = WeakThis.Get();
+			AActor* Root = Spawn->RootActor.Get();
+			UWorld* SpawnWorld = Spawn->World.Get();
+			if (!Importer || !Root || !SpawnWorld || Importer->CommitSerial != Spawn->CommitSerial)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("⚠️ Async spawn dropped after %d of %d nodes"), Spawn->NodeComponents.Num(), Spawn->Steps.Num());
+				Spawn->Promise.SetValue(nullptr);
+				return true;
+			}
+
+			FModelImportProfiler::FScopedContext ProfilerContext(Importer->LastImportProfiler.Get());
+			MODEL_IMPORT_SCOPE(SpawnNodeRecursive);
+
+			const int32 StepIndex = Spawn->NodeComponents.Num();
+			if (StepIndex < Spawn->Steps.Num())
+			{
+				const FAsyncSpawn::FStep& Step = Spawn->Steps[StepIndex];
+				USceneComponent* Parent = Step.Parent == INDEX_NONE ? Root->GetRootComponent() : Spawn->NodeComponents[Step.Parent].Get();
+				USceneComponent* NodeComponent = nullptr;
+
+				// A node that failed takes its subtree with it, as in the recursive spawn
+				if (Parent)
+				{
+					if (Importer->ImportSettings.SpawnHierarchy == EModelSpawnHierarchy::ComponentPerNode)
+					{
+						NodeComponent = Importer->SpawnNodeComponent(*Step.Node, Root, Parent, Step.ModelTransform, Spawn->Context);
+						Spawn->Context.RegisterPendingComponents(); // Per node here: the model fills in as it is built
+					}
+					else
+					{
+						NodeComponent = Importer->SpawnNodeActor(SpawnWorld, *Step.Node, Parent->GetOwner(), Step.ModelTransform, Spawn->Context);
+					}
+				}
+				Spawn->NodeComponents.Add(NodeComponent);
+
+				if (Spawn->NodeComponents.Num() == Spawn->Steps.Num())
+				{
+					Spawn->Context.InstanceTransforms.GetKeys(Spawn->InstancedSections);
+				}
+				return false;
+			}
+
+			if (Spawn->NextInstanced < Spawn->InstancedSections.Num())
+			{
+				const FModelMeshData* Section = Spawn->InstancedSections[Spawn->NextInstanced++];
+				Importer->SpawnInstancedSection(Root, *Section, Spawn->Context.InstanceTransforms[Section]);
+				return false;
+			}
+
+			UE_LOG(LogTemp, Log, TEXT("✅ Spawned model '%s' with %d nodes (time-sliced)"), *Importer->ModelName, Spawn->Steps.Num());
+			Spawn->Promise.SetValue(Root);
+			return true;
+		});
+
+	return Future;
+}
+
+void UAssimpRuntime3DModelsImporter::CountSectionReferences(const FModelNodeData& Node, TMap<const FModelMeshData*, int32>& OutCounts)
+{
+	for (const TSharedPtr<FModelMeshData>& Section : Node.MeshSections)
+	{
+		++OutCounts.FindOrAdd(Section.Get());
+	}
+	for (const FModelNodeData& Child : Node.Children)
+	{
+		CountSectionReferences(Child, OutCounts);
+	}
+}
+
+void UAssimpRuntime3DModelsImporter::SpawnInstancedSections(AActor* RootActor, FModelSpawnContext& Context)
+{
+	int32 NumInstances = 0;
+
+	// One component per shared section (a section is one mesh with one material, so one draw per cluster)
+	for (TPair<const FModelMeshData*, TArray<FTransform>>& Pair : Context.InstanceTransforms)
+	{
+		if (SpawnInstancedSection(RootActor, *Pair.Key, Pair.Value))
+		{
+			NumInstances += Pair.Value.Num();
+		}
+	}
+
+	if (Context.InstanceTransforms.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("🔹 Instanced %d mesh sections as %d components for '%s'"), NumInstances, Context.InstanceTransforms.Num(), *ModelName);
+	}
+}
+
+bool UAssimpRuntime3DModelsImporter::SpawnInstancedSection(AActor* RootActor, const FModelMeshData& Section, const TArray<FTransform>& Transforms)
+{
+	UStaticMesh* StaticMesh = GetOrBuildStaticMesh(Section);
+	if (!StaticMesh)
+	{
+		return false;
+	}
+
+	UInstancedStaticMeshComponent* Instances = ImportSettings.bUseHierarchicalInstancing
+		? NewObject<UHierarchicalInstancedStaticMeshComponent>(RootActor)
+		: NewObject<UInstancedStaticMeshComponent>(RootActor);
+	Instances->SetStaticMesh(StaticMesh);
+	Instances->SetMobility(EComponentMobility::Movable);
+	SetupComponentCollision(Instances, ImportSettings.CollisionMode);
+	Instances->SetupAttachment(RootActor->GetRootComponent());
+	RootActor->AddInstanceComponent(Instances);
+	Instances->RegisterComponent();
+
+	// Batched so the HISM builds its cluster tree once rather than per instance
+	Instances->AddInstances(Transforms, false, false);
+	return true;
+}
+
+FModelInstanceHandle UAssimpRuntime3DModelsImporter::SpawnInstance(UWorld* World, const FTransform& InstanceTransform)
+{
+	TArray<FModelInstanceHandle> Handles = SpawnInstances(World, { InstanceTransform });
+	return Handles.Num() > 0 ? Handles[0] : FModelInstanceHandle();
+}
+
+TArray<FModelInstanceHandle> UAssimpRuntime3DModelsImporter::SpawnInstances(UWorld* World, const TArray<FTransform>& InstanceTransforms)
+{
+	check(IsInGameThread());
+	FModelImportProfiler::FScopedContext ProfilerContext(LastImportProfiler.Get());
+	MODEL_IMPORT_SCOPE(SpawnInstances);
+
+	TArray<FModelInstanceHandle> Handles;
+	FModelTemplate* ModelTemplate = GetOrBuildTemplate(World);
+	if (!ModelTemplate)
+	{
+		return Handles;
+	}
+
+	TArray<int32> Ids;
+	ModelTemplate->AddInstances(InstanceTransforms, Ids);
+	for (int32 Id : Ids)
+	{
+		Handles.Add({ Id, TemplateSerial });
+	}
+	return Handles;
+}
+
+bool UAssimpRuntime3DModelsImporter::SetInstanceTransform(const FModelInstanceHandle& Handle, const FTransform& InstanceTransform)
+{
+	FModelTemplate* ModelTemplate = FindTemplate(Handle);
+	return ModelTemplate && ModelTemplate->SetInstanceTransform(Handle.Id, InstanceTransform);
+}
+
+bool UAssimpRuntime3DModelsImporter::RemoveInstance(const FModelInstanceHandle& Handle)
+{
+	FModelTemplate* ModelTemplate = FindTemplate(Handle);
+	return ModelTemplate && ModelTemplate->RemoveInstance(Handle.Id);
+}
+
+int32 UAssimpRuntime3DModelsImporter::GetNumInstances() const
+{
+	return Template.IsValid() ? Template->GetNumInstances() : 0;
+}
+
+FModelTemplate* UAssimpRuntime3DModelsImporter::FindTemplate(const FModelInstanceHandle& Handle) const
+{
+	return Template.IsValid() && Handle.TemplateSerial == TemplateSerial && Template->IsValidInstance(Handle.Id) ? Template.Get() : nullptr;
+}
+
+FModelTemplate* UAssimpRuntime3DModelsImporter::GetOrBuildTemplate(UWorld* World)
+{
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Invalid world context in SpawnInstance"));
+		return nullptr;
+	}
+	if (Template.IsValid() && Template->GetWorld() == World)
+	{
+		return Template.Get();
+	}
+
+	// One part per section, with every node transform it appears at; the static meshes (and their materials) are
+	// the same ones SpawnModel uses, so templates and full spawns of one import share render resources too
+	TMap<const FModelMeshData*, TArray<FTransform>> SectionTransforms;
+	CollectSectionTransforms(RootNode, FTransform::Identity, SectionTransforms);
+
+	TArray<FModelTemplate::FPart> Parts;
+	for (TPair<const FModelMeshData*, TArray<FTransform>>& Pair : SectionTransforms)
+	{
+		if (UStaticMesh* StaticMesh = GetOrBuildStaticMesh(*Pair.Key))
+		{
+			Parts.Add({ StaticMesh, MoveTemp(Pair.Value) });
+		}
+	}
+	if (Parts.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ Nothing to build a model template from for '%s'"), *ModelName);
+		return nullptr;
+	}
+
+	// Placements come and go long after this call, so the collision mode is taken now
+	TWeakObjectPtr<UAssimpRuntime3DModelsImporter> WeakThis(this);
+	const EModelCollisionMode CollisionMode = ImportSettings.CollisionMode;
+	auto SetupComponent = [WeakThis, CollisionMode](UStaticMeshComponent* Component)
+		{
+			if (UAssimpRuntime3DModelsImporter* Importer = WeakThis.Get())
+			{
+				Importer->SetupComponentCollision(Component, CollisionMode);
+			}
+		};
+
+	const int32 NumParts = Parts.Num();
+	Template = MakeShared<FModelTemplate>(World, MoveTemp(Parts), FMath::Max(1, ImportSettings.TemplatePromoteCount), ImportSettings.bUseHierarchicalInstancing, ModelName, MoveTemp(SetupComponent));
+	++TemplateSerial;
+	UE_LOG(LogTemp, Log, TEXT("🔹 Built model template '%s' with %d meshes"), *ModelName, NumParts);
+	return Template.Get();
+}
+
+void UAssimpRuntime3DModelsImporter::CollectSectionTransforms(const FModelNodeData& Node, const FTransform& ParentModelTransform, TMap<const FModelMeshData*, TArray<FTransform>>& OutTransforms)
+{
+	const FTransform ModelTransform = Node.Transform * ParentModelTransform;
+	for (const TSharedPtr<FModelMeshData>& Section : Node.MeshSections)
+	{
+		OutTransforms.FindOrAdd(Section.Get()).Add(ModelTransform);
+	}
+	for (const FModelNodeData& Child : Node.Children)
+	{
+		CollectSectionTransforms(Child, ModelTransform, OutTransforms);
+	}
+}
+
+static void BuildSectionMeshDescriptions(const FModelMeshData& Section, TArray<FMeshDescription>& OutDescriptions)
+{
+	OutDescriptions.SetNum(Section.GetNumLODs());
+	for (int32 LODIndex = 0; LODIndex < Section.GetNumLODs(); ++LODIndex)
+	{
+		FModelStaticMeshBuilder::BuildMeshDescription(Section, OutDescriptions[LODIndex], LODIndex);
+	}
+}
+
+UStaticMesh* UAssimpRuntime3DModelsImporter::GetOrBuildStaticMesh(const FModelMeshData& Section)
+{
+	if (UStaticMesh** Cached = StaticMeshCache.Find(&Section))
+	{
+		return *Cached;
+	}
+
+	MODEL_IMPORT_SCOPE(BuildStaticMesh);
+
+	// Normally prepared on the import worker; built here only when the settings changed after the import
+	TSharedPtr<TArray<FMeshDescription>> Descriptions;
+	PendingMeshDescriptions.RemoveAndCopyValue(&Section, Descriptions);
+	if (!Descriptions.IsValid())
+	{
+		Descriptions = MakeShared<TArray<FMeshDescription>>();
+		BuildSectionMeshDescriptions(Section, *Descriptions);
+	}
+
+	TArray<const FMeshDescription*> LODs;
+	TArray<float> ScreenSizes;
+	for (int32 LODIndex = 0; LODIndex < Descriptions->Num(); ++LODIndex)
+	{
+		LODs.Add(&(*Descriptions)[LODIndex]);
+		ScreenSizes.Add(ImportSettings.GetLODScreenSize(LODIndex));
+	}
+
+	UMaterialInterface* Material = Section.Material ? Section.Material :
+		LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial"));
+	const bool bComplexCollision = ImportSettings.CollisionMode == EModelCollisionMode::Complex || ImportSettings.bKeepComplexCollisionData;
+	UStaticMesh* StaticMesh = FModelStaticMeshBuilder::CreateStaticMesh(this, LODs, ScreenSizes, Material, bComplexCollision);
+
+	// Cached even when the build failed, so a bad section is not rebuilt for every instance
+	StaticMeshCache.Add(&Section, StaticMesh);
+	if (StaticMesh)
+	{
+		BuiltStaticMeshes.Add(StaticMesh);
+		StaticMeshSections.Add(StaticMesh, &Section);
+		if (bComplexCollision)
+		{
+			CpuAccessibleMeshes.Add(StaticMesh);
+		}
+		SetupStaticMeshCollision(StaticMesh, Section, ImportSettings.CollisionMode);
+	}
+	return StaticMesh;
+}
+
+const TArray<FVector>& UAssimpRuntime3DModelsImporter::GetCollisionHull(const FModelMeshData& Section)
+{
+	if (const TArray<FVector>* Hull = CollisionHulls.Find(&Section))
+	{
+		return *Hull;
+	}
+
+	TArray<FVector>& Hull = CollisionHulls.Add(&Section);
+	FModelCollisionBuilder::BuildConvexHullPoints(Section, Hull);
+	return Hull;
+}
+
+const TArray<TArray<FVector>>& UAssimpRuntime3DModelsImporter::GetConvexDecomposition(const FModelMeshData& Section)
+{
+	if (const TArray<TArray<FVector>>* Hulls = ConvexDecompositions.Find(&Section))
+	{
+		return *Hulls;
 	}
+
+	UE_LOG(LogTemp, Warning, TEXT("⚠️ Decomposing a mesh of '%s' on the GameThread; import with CollisionMode ConvexDecomposition to do it on a worker"), *ModelName);
+	TArray<TArray<FVector>>& Hulls = ConvexDecompositions.Add(&Section);
+	FModelConvexDecomposer::Decompose(Section, GetDecompositionParams(ImportSettings), Hulls);
+	return Hulls;
 }
 
-void UAssimpRuntime3DModelsImporter::ExtractMesh(aiMesh* Mesh, const aiScene* Scene, FModelMeshData& OutMesh, const FString& FbxFilePath)
+TArrayView<const TArray<FVector>> UAssimpRuntime3DModelsImporter::GetSectionHulls(const FModelMeshData& Section, EModelCollisionMode Mode)
 {
-	const bool bHasNormals = Mesh->HasNormals();
-	const bool bHasUVs = Mesh->HasTextureCoords(0);
+	if (Mode == EModelCollisionMode::SimplifiedConvex)
+	{
+		return MakeArrayView(&GetCollisionHull(Section), 1);
+	}
+	if (Mode == EModelCollisionMode::ConvexDecomposition)
+	{
+		return GetConvexDecomposition(Section);
+	}
+	return TArrayView<const TArray<FVector>>();
+}
 
-	// --- Vertices, Normals, UVs ---
-	for (uint32 i = 0; i < Mesh->mNumVertices; ++i)
+void UAssimpRuntime3DModelsImporter::SetupStaticMeshCollision(UStaticMesh* StaticMesh, const FModelMeshData& Section, EModelCollisionMode Mode)
+{
+	// Rebuilding a body setup under its own async cook is not safe; the last mode asked for wins once it lands
+	if (FPendingCollisionCook* Cook = CookingStaticMeshes.Find(StaticMesh))
+	{
+		Cook->NextMode = Mode;
+		return;
+	}
+	if (Mode == EModelCollisionMode::None)
 	{
-		OutMesh.Vertices.Add(FVector(Mesh->mVertices[i].x, Mesh->mVertices[i].z, Mesh->mVertices[i].y));
+		return; // Components switch their collision off; whatever the mesh cooked before stays for the next mode
+	}
 
-		if (bHasNormals)
-			OutMesh.Normals.Add(FVector(Mesh->mNormals[i].x, Mesh->mNormals[i].z, Mesh->mNormals[i].y));
-		else
-			OutMesh.Normals.Add(FVector::UpVector);
+	MODEL_IMPORT_SCOPE(CookCollision);
 
-		if (bHasUVs)
-			OutMesh.UVs.Add(FVector2D(Mesh->mTextureCoords[0][i].x, Mesh->mTextureCoords[0][i].y));
-		else
-			OutMesh.UVs.Add(FVector2D::ZeroVector);
+	// Triangle collision cooks from the CPU copy of the render data, which only meshes built for Complex (or with
+	// bKeepComplexCollisionData) keep; any other mesh is rebuilt with it the first time Complex is asked for
+	if (Mode == EModelCollisionMode::Complex && !CpuAccessibleMeshes.Contains(StaticMesh))
+	{
+		UE_LOG(LogTemp, Log, TEXT("🔹 Rebuilding a mesh of '%s' with complex collision data"), *ModelName);
+		TArray<FMeshDescription> Descriptions;
+		BuildSectionMeshDescriptions(Section, Descriptions);
+		TArray<const FMeshDescription*> LODs;
+		TArray<float> ScreenSizes;
+		for (int32 LODIndex = 0; LODIndex < Descriptions.Num(); ++LODIndex)
+		{
+			LODs.Add(&Descriptions[LODIndex]);
+			ScreenSizes.Add(ImportSettings.GetLODScreenSize(LODIndex));
+		}
+		if (!FModelStaticMeshBuilder::RebuildStaticMesh(StaticMesh, LODs, ScreenSizes, true))
+		{
+			UE_LOG(LogTemp, Error, TEXT("❌ Failed to rebuild a mesh of '%s' for complex collision, its collision is unchanged"), *ModelName);
+			return;
+		}
+		CpuAccessibleMeshes.Add(StaticMesh);
 	}
 
-	// --- Tangents & Bitangents ---
-	if (!Mesh->HasTangentsAndBitangents())
+	StaticMesh->CreateBodySetup();
+	UBodySetup* BodySetup = StaticMesh->GetBodySetup();
+	BodySetup->InvalidatePhysicsData();
+	BodySetup->RemoveSimpleCollision();
+	if (Mode == EModelCollisionMode::Complex)
 	{
-		// Generate tangents using UE's helper
-		TArray<FProcMeshTangent> GeneratedTangents;
-		UKismetProceduralMeshLibrary::CalculateTangentsForMesh(
-			OutMesh.Vertices,
-			OutMesh.Triangles,
-			OutMesh.UVs,
-			OutMesh.Normals,
-			GeneratedTangents
-		);
-
-		// Store them directly in OutMesh.Tangents as FVector (you can convert)
-		OutMesh.Tangents.Empty();
-		for (const FProcMeshTangent& Tangent : GeneratedTangents)
+		BodySetup->CollisionTraceFlag = CTF_UseComplexAsSimple;
+	}
+	else
+	{
+		BodySetup->CollisionTraceFlag = CTF_UseSimpleAsComplex;
+		if (FModelCollisionBuilder::SetConvexCollision(BodySetup, GetSectionHulls(Section, Mode)) == 0)
 		{
-			OutMesh.Tangents.Add(Tangent.TangentX); // TangentX is FVector
+			FModelCollisionBuilder::SetBoxCollision(BodySetup, StaticMesh->GetBoundingBox());
 		}
+	}
 
-		// No need to store bitangents; UE procedural mesh calculates internally
+	if (!ImportSettings.bAsyncCollisionCooking)
+	{
+		BodySetup->CreatePhysicsMeshes();
+		return;
 	}
 
+	// Components registered before the cook lands come up without a body; OnStaticMeshCollisionCooked recreates theirs
+	TWeakObjectPtr<UAssimpRuntime3DModelsImporter> WeakThis(this);
+	TWeakObjectPtr<UStaticMesh> WeakMesh(StaticMesh);
+	CookingStaticMeshes.Add(WeakMesh);
+	BodySetup->CreatePhysicsMeshesAsync(FOnAsyncPhysicsCookFinished::CreateLambda([WeakThis, WeakMesh](bool bSuccess)
+		{
+			if (UAssimpRuntime3DModelsImporter* Importer = WeakThis.Get())
+			{
+				Importer->OnStaticMeshCollisionCooked(WeakMesh, bSuccess);
+			}
+		}));
+}
+
+void UAssimpRuntime3DModelsImporter::OnStaticMeshCollisionCooked(TWeakObjectPtr<UStaticMesh> WeakMesh, bool bSuccess)
+{
+	FPendingCollisionCook Cook;
+	if (!CookingStaticMeshes.RemoveAndCopyValue(WeakMesh, Cook))
+	{
+		return;
+	}
 
+	UStaticMesh* StaticMesh = WeakMesh.Get();
+	if (!StaticMesh)
+	{
+		return;
+	}
+	if (!bSuccess)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ Collision cook failed for a mesh of '%s'"), *ModelName);
+	}
 
-	// --- Triangles ---
-	for (uint32 i = 0; i < Mesh->mNumFaces; ++i)
+	// Only meshes of the current import still map to a section; older ones keep what they have
+	const FModelMeshData* const* Section = StaticMeshSections.Find(StaticMesh);
+	if (Cook.NextMode.IsSet() && Section)
 	{
-		const aiFace& Face = Mesh->mFaces[i];
-		if (Face.mNumIndices == 3)
+		SetupStaticMeshCollision(StaticMesh, **Section, Cook.NextMode.GetValue());
+		if (FPendingCollisionCook* NextCook = CookingStaticMeshes.Find(StaticMesh))
 		{
-			OutMesh.Triangles.Add(Face.mIndices[0]);
-			OutMesh.Triangles.Add(Face.mIndices[1]);
-			OutMesh.Triangles.Add(Face.mIndices[2]);
+			NextCook->Components.Append(Cook.Components);
+			return;
 		}
 	}
 
-	// --- Material assignment ---
-	if (Mesh->mMaterialIndex >= 0 && Scene->mMaterials[Mesh->mMaterialIndex])
+	for (const TWeakObjectPtr<UPrimitiveComponent>& WeakComponent : Cook.Components)
 	{
-		OutMesh.Material = CreateMaterialFromAssimp(Scene->mMaterials[Mesh->mMaterialIndex], Scene, FbxFilePath);
+		UPrimitiveComponent* Component = WeakComponent.Get();
+		if (Component && Component->IsRegistered())
+		{
+			Component->RecreatePhysicsState();
+		}
 	}
 }
 
-AActor* UAssimpRuntime3DModelsImporter::SpawnModel(UWorld* World, const FTransform& modelTransform)
+void UAssimpRuntime3DModelsImporter::SetupComponentCollision(UStaticMeshComponent* Component, EModelCollisionMode Mode)
 {
-	if (!World)
+	Component->SetCollisionEnabled(Mode == EModelCollisionMode::None ? ECollisionEnabled::NoCollision : ECollisionEnabled::QueryAndPhysics);
+	if (FPendingCollisionCook* Cook = CookingStaticMeshes.Find(Component->GetStaticMesh().Get()))
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ Invalid world context in SpawnModel"));
-		return nullptr;
+		Cook->Components.Add(Component);
 	}
+}
 
-	// Spawn the root container actor
-	AActor* RootActor = World->SpawnActor<AActor>(AActor::StaticClass(), modelTransform);
+void UAssimpRuntime3DModelsImporter::ApplyProcMeshCollision(UProceduralMeshComponent* Mesh, EModelCollisionMode Mode, TArrayView<const TArray<FVector>> Hulls)
+{
+	MODEL_IMPORT_SCOPE(CookCollision);
 
-	if (!RootActor)
+	Mesh->SetCollisionEnabled(Mode == EModelCollisionMode::None ? ECollisionEnabled::NoCollision : ECollisionEnabled::QueryAndPhysics);
+	Mesh->bUseComplexAsSimpleCollision = Mode == EModelCollisionMode::Complex;
+
+	// Triangle collision is a per-section flag; setting the section again recooks, so only when it actually flips
+	const bool bComplex = Mode == EModelCollisionMode::Complex;
+	if (FProcMeshSection* ProcSection = Mesh->GetProcMeshSection(0))
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ Failed to spawn RootActor"));
-		return nullptr;
+		if (ProcSection->bEnableCollision != bComplex)
+		{
+			FProcMeshSection Updated = *ProcSection;
+			Updated.bEnableCollision = bComplex;
+			Mesh->SetProcMeshSection(0, Updated);
+		}
 	}
-	else
+
+	const FProcMeshSection* ProcSection = Mesh->GetProcMeshSection(0);
+	if (!ProcSection || Mode == EModelCollisionMode::None || bComplex)
 	{
-		RootFBXActor = RootActor;
+		Mesh->ClearCollisionConvexMeshes();
+		return;
+	}
 
+	TArray<TArray<FVector>> ComputedHulls;
+	if (Hulls.Num() == 0)
+	{
+		const TArray<FProcMeshVertex>& Vertices = ProcSection->ProcVertexBuffer;
+		const TArray<uint32>& Indices = ProcSection->ProcIndexBuffer;
+		if (Mode == EModelCollisionMode::SimplifiedConvex)
+		{
+			FModelCollisionBuilder::BuildConvexHullPoints(Vertices.Num(), [&Vertices](int32 Index) { return Vertices[Index].Position; }, ComputedHulls.AddDefaulted_GetRef());
+		}
+		else if (Mode == EModelCollisionMode::ConvexDecomposition)
+		{
+			FModelConvexDecomposer::Decompose(Indices.Num() / 3, [&Vertices, &Indices](int32 Triangle, FVector (&OutCorners)[3])
+				{
+					for (int32 Corner = 0; Corner < 3; ++Corner)
+					{
+						OutCorners[Corner] = Vertices[Indices[Triangle * 3 + Corner]].Position;
+					}
+				}, GetDecompositionParams(ImportSettings), ComputedHulls);
+		}
+		Hulls = ComputedHulls;
 	}
 
-#if WITH_EDITOR
-	RootActor->SetActorLabel(ModelName);
-#endif
+	TArray<TArray<FVector>> ConvexMeshes;
+	for (const TArray<FVector>& Hull : Hulls)
+	{
+		if (Hull.Num() >= FModelCollisionBuilder::MinHullPoints)
+		{
+			ConvexMeshes.Add(Hull);
+		}
+	}
+	if (ConvexMeshes.Num() == 0)
+	{
+		FModelCollisionBuilder::GetBoxPoints(ProcSection->SectionLocalBox, ConvexMeshes.AddDefaulted_GetRef());
+	}
+	Mesh->SetCollisionConvexMeshes(ConvexMeshes);
+}
 
-	// Add root scene component
-	USceneComponent* RootComp = NewObject<USceneComponent>(RootActor);
-	if (!RootComp)
+void UAssimpRuntime3DModelsImporter::SetModelCollision(AActor* ModelActor, EModelCollisionMode Mode)
+{
+	check(IsInGameThread());
+	if (!ModelActor)
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ Failed to create RootComponent"));
-		RootActor->Destroy();
-		return nullptr;
+		return;
 	}
 
-	RootComp->RegisterComponent();
-	RootActor->SetRootComponent(RootComp);
-	RootActor->SetActorTransform(FTransform(modelTransform));
+	FModelImportProfiler::FScopedContext ProfilerContext(LastImportProfiler.Get());
 
+	// The root and, in ActorPerNode, every node actor under it
+	TArray<AActor*> Actors;
+	ModelActor->GetAttachedActors(Actors, false, true);
+	Actors.Add(ModelActor);
 
+	TSet<UStaticMesh*> UpdatedMeshes;
+	int32 NumComponents = 0;
+	for (AActor* Actor : Actors)
+	{
+		TInlineComponentArray<UPrimitiveComponent*> Components(Actor);
+		for (UPrimitiveComponent* Component : Components)
+		{
+			if (UProceduralMeshComponent* ProcMesh = Cast<UProceduralMeshComponent>(Component))
+			{
+				ProcMesh->bUseAsyncCooking = ImportSettings.bAsyncCollisionCooking;
+				ApplyProcMeshCollision(ProcMesh, Mode, {});
+				++NumComponents;
+				continue;
+			}
 
-	// ✅ Spawn the entire hierarchy starting from the real RootNode
-	SpawnNodeRecursive(World, RootNode, RootActor);
+			// Instanced components included; the body setup belongs to the mesh, so each mesh is set up once
+			UStaticMeshComponent* MeshComp = Cast<UStaticMeshComponent>(Component);
+			UStaticMesh* StaticMesh = MeshComp ? MeshComp->GetStaticMesh() : nullptr;
+			const FModelMeshData* const* Section = StaticMesh ? StaticMeshSections.Find(StaticMesh) : nullptr;
+			if (!Section)
+			{
+				continue; // Not from the current import
+			}
 
-	// ✅ Optional debug log
-	UE_LOG(LogTemp, Log, TEXT("✅ Spawned model '%s' with %d nodes"), *ModelName, SpawnedNodeActors.Num());
+			bool bAlreadyUpdated = false;
+			UpdatedMeshes.Add(StaticMesh, &bAlreadyUpdated);
+			if (!bAlreadyUpdated)
+			{
+				SetupStaticMeshCollision(StaticMesh, **Section, Mode);
+			}
+			SetupComponentCollision(MeshComp, Mode);
+			if (!CookingStaticMeshes.Contains(StaticMesh))
+			{
+				MeshComp->RecreatePhysicsState();
+			}
+			++NumComponents;
+		}
+	}
 
-	// Uncomment to list all spawned nodes
-	/*
-	for (const auto& Pair : SpawnedNodeActors)
+	UE_LOG(LogTemp, Log, TEXT("🔹 Collision of '%s' set to %s on %d components"), *ModelName, *UEnum::GetValueAsString(Mode), NumComponents);
+}
+
+void UAssimpRuntime3DModelsImporter::SpawnNodeRecursive(UWorld* World, const FModelNodeData& Node, AActor* Parent, const FTransform& ParentModelTransform, FModelSpawnContext& Context)
+{
+	const FTransform ModelTransform = Node.Transform * ParentModelTransform;
+	USceneComponent* NodeComponent = SpawnNodeActor(World, Node, Parent, ModelTransform, Context);
+	if (!NodeComponent)
 	{
-		UE_LOG(LogTemp, Log, TEXT("   - Spawned NodeActor: %s"), *Pair.Key);
+		return;
 	}
-	*/
 
-	return RootActor;
+	// Recursively spawn children
+	for (const FModelNodeData& Child : Node.Children)
+	{
+		SpawnNodeRecursive(World, Child, NodeComponent->GetOwner(), ModelTransform, Context);
+	}
 }
 
-void UAssimpRuntime3DModelsImporter::SpawnNodeRecursive(UWorld* World, const FModelNodeData& Node, AActor* Parent)
+USceneComponent* UAssimpRuntime3DModelsImporter::SpawnNodeActor(UWorld* World, const FModelNodeData& Node, AActor* Parent, const FTransform& ModelTransform, FModelSpawnContext& Context)
 {
 	if (!World || !Parent)
 	{
 		UE_LOG(LogTemp, Error, TEXT("❌ World or Parent Actor is invalid."));
-		return;
+		return nullptr;
 	}
 
 	// Spawn Actor safely using deferred spawning
@@ -178,7 +1261,7 @@ void UAssimpRuntime3DModelsImporter::SpawnNodeRecursive(UWorld* World, const FMo
 	if (!NodeActor)
 	{
 		UE_LOG(LogTemp, Error, TEXT("❌ Failed to spawn NodeActor for node: %s"), *Node.Name);
-		return;
+		return nullptr;
 	}
 
 #if WITH_EDITOR
@@ -191,7 +1274,7 @@ void UAssimpRuntime3DModelsImporter::SpawnNodeRecursive(UWorld* World, const FMo
 	{
 		UE_LOG(LogTemp, Error, TEXT("❌ Failed to create RootComp for node: %s"), *Node.Name);
 		NodeActor->Destroy();
-		return;
+		return nullptr;
 	}
 
 	RootComp->RegisterComponent();
@@ -201,40 +1284,78 @@ void UAssimpRuntime3DModelsImporter::SpawnNodeRecursive(UWorld* World, const FMo
 
 	// Store reference AFTER verifying NodeActor initialization
 	SpawnedNodeActors.Add(Node.Name, NodeActor);
+	SpawnedNodeComponents.Add(Node.Name, RootComp);
+
+	// Node actors are still spawned for instanced sections, so named attachment nodes stay addressable
+	CreateSectionComponents(Node, NodeActor, RootComp, ModelTransform, Context);
+	Context.RegisterPendingComponents();
+
+	// Finish spawning to ensure full initialization
+	UGameplayStatics::FinishSpawningActor(NodeActor, NodeActor->GetTransform());
+	return RootComp;
+}
 
-	// Create mesh sections
-	for (const FModelMeshData& Section : Node.MeshSections)
+void UAssimpRuntime3DModelsImporter::CreateSectionComponents(const FModelNodeData& Node, AActor* Owner, USceneComponent* NodeComponent, const FTransform& ModelTransform, FModelSpawnContext& Context)
+{
+	// Components are fully set up before they register, so each creates its render and physics state once.
+	// Registration is left to the caller: right away per node actor, or one batch for the component hierarchy
+	for (const TSharedPtr<FModelMeshData>& SectionPtr : Node.MeshSections)
 	{
-		UProceduralMeshComponent* Mesh = NewObject<UProceduralMeshComponent>(NodeActor);
+		const FModelMeshData& Section = *SectionPtr;
+		if (Context.IsInstanced(&Section))
+		{
+			Context.InstanceTransforms.FindOrAdd(&Section).Add(ModelTransform);
+			continue;
+		}
+
+		if (ImportSettings.SpawnBackend == EModelSpawnBackend::StaticMesh)
+		{
+			UStaticMesh* StaticMesh = GetOrBuildStaticMesh(Section);
+			if (!StaticMesh)
+			{
+				continue;
+			}
+
+			UStaticMeshComponent* MeshComp = NewObject<UStaticMeshComponent>(Owner);
+			MeshComp->SetStaticMesh(StaticMesh);
+			MeshComp->SetupAttachment(NodeComponent);
+			SetupComponentCollision(MeshComp, ImportSettings.CollisionMode);
+			Owner->AddInstanceComponent(MeshComp);
+			Context.PendingRegistration.Add(MeshComp);
+			continue;
+		}
+
+		UProceduralMeshComponent* Mesh = NewObject<UProceduralMeshComponent>(Owner);
 		if (!Mesh)
 		{
 			UE_LOG(LogTemp, Error, TEXT("❌ Failed to create MeshComponent for node: %s"), *Node.Name);
 			continue;
 		}
 
-		Mesh->RegisterComponent();
-		Mesh->AttachToComponent(RootComp, FAttachmentTransformRules::KeepRelativeTransform);
-		NodeActor->AddInstanceComponent(Mesh);
+		Mesh->SetupAttachment(NodeComponent);
+		Owner->AddInstanceComponent(Mesh);
 
-		// --- Convert FVector tangents to FProcMeshTangent ---
+		// --- Decode the section streams (float or quantized) into the procedural mesh's own double-precision arrays ---
+		TArray<FVector> Vertices;
+		TArray<FVector> Normals;
+		TArray<FVector2D> UVs;
 		TArray<FProcMeshTangent> ProcTangents;
-		for (const FVector& TangentVec : Section.Tangents)
-		{
-			// true = Flip Y to match UE coordinate system (tangent space)
-			ProcTangents.Add(FProcMeshTangent(TangentVec, true));
-		}
+		DecodeProcMeshStreams(Section, Vertices, Normals, UVs, ProcTangents);
 
 		// --- Create mesh section ---
+		const EModelCollisionMode CollisionMode = ImportSettings.CollisionMode;
+		Mesh->bUseAsyncCooking = ImportSettings.bAsyncCollisionCooking;
 		Mesh->CreateMeshSection_LinearColor(
 			0,
-			Section.Vertices,
-			Section.Triangles,
-			Section.Normals,
-			Section.UVs,
+			Vertices,
+			TArray<int32>(Section.GetIndices().GetData(), Section.GetNumIndices()),
+			Normals,
+			UVs,
 			{},           // Vertex Colors (unused)
 			ProcTangents, // Tangents
-			true          // Enable collision
+			CollisionMode == EModelCollisionMode::Complex // Triangle collision
 		);
+		ApplyProcMeshCollision(Mesh, CollisionMode, GetSectionHulls(Section, CollisionMode));
 
 		// --- Assign material ---
 		Mesh->SetMaterial(
@@ -242,19 +1363,34 @@ void UAssimpRuntime3DModelsImporter::SpawnNodeRecursive(UWorld* World, const FMo
 			Section.Material ? Section.Material :
 			LoadObject<UMaterialInterface>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial"))
 		);
+		Context.PendingRegistration.Add(Mesh);
 	}
+}
 
+void UAssimpRuntime3DModelsImporter::SpawnNodeComponentsRecursive(const FModelNodeData& Node, AActor* Owner, USceneComponent* Parent, const FTransform& ParentModelTransform, FModelSpawnContext& Context)
+{
+	const FTransform ModelTransform = Node.Transform * ParentModelTransform;
+	USceneComponent* NodeComp = SpawnNodeComponent(Node, Owner, Parent, ModelTransform, Context);
 
-	// Finish spawning to ensure full initialization
-	UGameplayStatics::FinishSpawningActor(NodeActor, NodeActor->GetTransform());
-
-	// Recursively spawn children
 	for (const FModelNodeData& Child : Node.Children)
 	{
-		SpawnNodeRecursive(World, Child, NodeActor);
+		SpawnNodeComponentsRecursive(Child, Owner, NodeComp, ModelTransform, Context);
 	}
 }
 
+USceneComponent* UAssimpRuntime3DModelsImporter::SpawnNodeComponent(const FModelNodeData& Node, AActor* Owner, USceneComponent* Parent, const FTransform& ModelTransform, FModelSpawnContext& Context)
+{
+	USceneComponent* NodeComp = NewObject<USceneComponent>(Owner);
+	NodeComp->SetupAttachment(Parent);
+	NodeComp->SetRelativeTransform(Node.Transform);
+	Owner->AddInstanceComponent(NodeComp);
+	Context.PendingRegistration.Add(NodeComp);
+	SpawnedNodeComponents.Add(Node.Name, NodeComp);
+
+	CreateSectionComponents(Node, Owner, NodeComp, ModelTransform, Context);
+	return NodeComp;
+}
+
 FTransform UAssimpRuntime3DModelsImporter::ConvertAssimpMatrix(const aiMatrix4x4& AssimpMatrix)
 {
 	aiVector3D Scale, Position;
@@ -289,325 +1425,199 @@ void UAssimpRuntime3DModelsImporter::LoadMasterMaterial()
 	}
 }
 
-UMaterialInstanceDynamic* UAssimpRuntime3DModelsImporter::CreateMaterialFromAssimp(
+void UAssimpRuntime3DModelsImporter::ExtractMaterial(
 	aiMaterial* AssimpMaterial,
 	const aiScene* Scene,
+	FModelMaterialData& OutMaterial,
 	const FString& FbxFilePath)
 {
+	MODEL_IMPORT_SCOPE(ExtractMaterial);
+
 	if (!AssimpMaterial)
 	{
 		UE_LOG(LogTemp, Error, TEXT("❌ Null AssimpMaterial provided."));
-		return nullptr;
+		return;
 	}
 
 	// Material name
 	aiString AssimpMatName;
 	if (AssimpMaterial->Get(AI_MATKEY_NAME, AssimpMatName) != AI_SUCCESS)
 		AssimpMatName = aiString("UnnamedMaterial");
-	FString MaterialNameStr = UTF8_TO_TCHAR(AssimpMatName.C_Str());
-
-	// ----------------------------
-	// Cache check first!
-	// ----------------------------
-	if (MaterialCache.Contains(AssimpMaterial))
-	{
-		UE_LOG(LogTemp, Log, TEXT("🔹 Using cached Material Instance: %s"), *MaterialNameStr);
-		return MaterialCache[AssimpMaterial];
-	}
-
-	// Only log creation if new
-	UE_LOG(LogTemp, Log, TEXT("🔹 Creating Material Instance: %s"), *MaterialNameStr);
-
-	if (!MasterMaterial)
-		LoadMasterMaterial();
-	if (!MasterMaterial)
-	{
-		UE_LOG(LogTemp, Error, TEXT("❌ No valid MasterMaterial loaded."));
-		return nullptr;
-	}
-
-	// Create dynamic instance
-	UMaterialInstanceDynamic* MatInstance = UMaterialInstanceDynamic::Create(MasterMaterial, GetTransientPackage());
-	if (!MatInstance)
-	{
-		UE_LOG(LogTemp, Error, TEXT("❌ Failed to create dynamic material instance."));
-		return nullptr;
-	}
+	OutMaterial.Name = UTF8_TO_TCHAR(AssimpMatName.C_Str());
 
 	const FString BaseDir = FPaths::GetPath(FbxFilePath);
 
-	LoadedMaterials.Add(MatInstance);
-	MaterialCache.Add(AssimpMaterial, MatInstance);
-
-	// ----------------------------
-	// Track applied parameters to avoid duplicates
-	// ----------------------------
-	TSet<FName> AppliedParameters;
-
 	// Fallback BaseColor
 	aiColor3D DiffuseColor(0.f, 0.f, 0.f);
 	if (AssimpMaterial->Get(AI_MATKEY_COLOR_DIFFUSE, DiffuseColor) == AI_SUCCESS)
 	{
-		FLinearColor Color(DiffuseColor.r, DiffuseColor.g, DiffuseColor.b);
-		MatInstance->SetVectorParameterValue("BaseColor", Color);
-		UE_LOG(LogTemp, Log, TEXT("   [%s] 🎨 Fallback Base Color: R=%.2f G=%.2f B=%.2f"),
-			*MaterialNameStr, Color.R, Color.G, Color.B);
+		OutMaterial.bHasBaseColor = true;
+		OutMaterial.BaseColor = FLinearColor(DiffuseColor.r, DiffuseColor.g, DiffuseColor.b);
 	}
 
 	// ----------------------------
-	// Lambda to apply textures
+	// Lambda to record texture slots (resolved here, loaded on the GameThread)
 	// ----------------------------
-	auto TryApplyTexture = [&](aiTextureType Type, const FName& ParamName, bool bIsColor)
+	auto AddTextureSlot = [&](aiTextureType Type, const FName& ParamName, bool bIsColor)
 		{
-			if (AppliedParameters.Contains(ParamName))
-				return;
-
 			aiString TexPath;
-			if (AssimpMaterial->GetTexture(Type, 0, &TexPath) == AI_SUCCESS)
-			{
-				FString Path = UTF8_TO_TCHAR(TexPath.C_Str());
-				UTexture2D* Texture = nullptr;
-				FString AppliedTextureName = "None";
-
-				const aiTexture* Embedded = Scene->GetEmbeddedTexture(TexPath.C_Str());
-				if (Embedded)
-				{
-					Texture = CreateTextureFromEmbedded(Embedded, Path, Type, MaterialNameStr, ParamName);
-					AppliedTextureName = FString::Printf(TEXT("Embedded (%s)"), *Path);
-				}
-				else
-				{
-					FString FileNameOnly = FPaths::GetCleanFilename(Path);
-					TArray<FString> FoundFiles;
-					IFileManager::Get().FindFilesRecursive(FoundFiles, *BaseDir, *FileNameOnly, true, false);
+			if (AssimpMaterial->GetTexture(Type, 0, &TexPath) != AI_SUCCESS)
+				return;
 
-					FString FoundTexturePath = (FoundFiles.Num() > 0) ? FoundFiles[0] : FPaths::Combine(BaseDir, Path);
-					FPaths::NormalizeFilename(FoundTexturePath);
+			FModelTextureSlot& Slot = OutMaterial.Textures.AddDefaulted_GetRef();
+			Slot.ParamName = ParamName;
+			Slot.TextureType = Type;
+			Slot.bIsColor = bIsColor;
+			Slot.SourcePath = UTF8_TO_TCHAR(TexPath.C_Str());
 
-					if (FPaths::FileExists(FoundTexturePath))
-						Texture = LoadTextureFromDisk(FoundTexturePath, MaterialNameStr, ParamName, Type); // Pass Type here!
-				}
+			const aiTexture* Embedded = Scene->GetEmbeddedTexture(TexPath.C_Str());
+			if (Embedded)
+			{
+				// mHeight == 0: compressed blob of mWidth bytes, otherwise mWidth * mHeight BGRA texels
+				const int32 NumBytes = Embedded->mHeight == 0 ? Embedded->mWidth : Embedded->mWidth * Embedded->mHeight * sizeof(aiTexel);
+				Slot.EmbeddedData.Append(reinterpret_cast<const uint8*>(Embedded->pcData), NumBytes);
+				Slot.EmbeddedWidth = Embedded->mWidth;
+				Slot.EmbeddedHeight = Embedded->mHeight;
+			}
+			else
+			{
+				FString FileNameOnly = FPaths::GetCleanFilename(Slot.SourcePath);
+				TArray<FString> FoundFiles;
+				IFileManager::Get().FindFilesRecursive(FoundFiles, *BaseDir, *FileNameOnly, true, false);
 
-				if (Texture)
-				{
-					Texture->SRGB = bIsColor;
-					MatInstance->SetTextureParameterValue(ParamName, Texture);
-					AppliedParameters.Add(ParamName);
-					UE_LOG(LogTemp, Display, TEXT("   [%s] ✅ Texture applied: %s -> Parameter: %s"),
-						*MaterialNameStr, *AppliedTextureName, *ParamName.ToString());
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("   [%s] ⚠️ Texture not found for Parameter: %s"),
-						*MaterialNameStr, *ParamName.ToString());
-				}
+				Slot.ResolvedPath = (FoundFiles.Num() > 0) ? FoundFiles[0] : FPaths::Combine(BaseDir, Slot.SourcePath);
+				FPaths::NormalizeFilename(Slot.ResolvedPath);
 			}
 		};
 
 	// ----------------------------
-	// Apply all 6 parameters
+	// All 6 parameters, in priority order
 	// ----------------------------
-	TryApplyTexture(aiTextureType_DIFFUSE, "BaseColor", true);
-	TryApplyTexture(aiTextureType_BASE_COLOR, "BaseColor", true);
-
-	TryApplyTexture(aiTextureType_NORMALS, "Normal", false);
-	TryApplyTexture(aiTextureType_NORMAL_CAMERA, "Normal", false);
-	TryApplyTexture(aiTextureType_HEIGHT, "Normal", false);
-	TryApplyTexture(aiTextureType_DISPLACEMENT, "Normal", false);
-
-	TryApplyTexture(aiTextureType_METALNESS, "Metallic", false);
-	// TryApplyTexture(aiTextureType_SPECULAR, "Metallic", false); // Sometimes specular is used for metal
-
-
-	TryApplyTexture(aiTextureType_SPECULAR, "Specular", false);
-
-
-	TryApplyTexture(aiTextureType_AMBIENT_OCCLUSION, "AmbientOcclusion", false);
-	TryApplyTexture(aiTextureType_AMBIENT, "AmbientOcclusion", false);
-
-	TryApplyTexture(aiTextureType_DIFFUSE_ROUGHNESS, "Roughness", false);
-	// TryApplyTexture(aiTextureType_SHININESS, "Roughness", false); // Shininess often contains roughness
-
-
-	TryApplyTexture(aiTextureType_EMISSION_COLOR, "Emmisive", false);
-	TryApplyTexture(aiTextureType_EMISSIVE, "Emmisive", false);
-
-
-	TryApplyTexture(aiTextureType_OPACITY, "Opacity", false);
-
-	UE_LOG(LogTemp, Log, TEXT("🔹 Finished Material Instance: %s"), *MaterialNameStr);
-
-	return MatInstance;
-}
-
-
-UTexture2D* UAssimpRuntime3DModelsImporter::CreateTextureFromEmbedded(
-	const aiTexture* EmbeddedTex,
-	const FString& DebugName,
-	aiTextureType Type,
-	const FString& MaterialName,
-	const FName& ParamName)
-{
-	if (!EmbeddedTex) return nullptr;
-
-	UTexture2D* Texture = nullptr;
-
-	// --- Compressed texture (PNG/JPG) ---
-	if (EmbeddedTex->mHeight == 0)
-	{
-		const uint8* CompressedData = reinterpret_cast<const uint8*>(EmbeddedTex->pcData);
-		int32 DataSize = EmbeddedTex->mWidth;
-
-		IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>("ImageWrapper");
-		EImageFormat Format = ImageWrapperModule.DetectImageFormat(CompressedData, DataSize);
-		TSharedPtr<IImageWrapper> Wrapper = ImageWrapperModule.CreateImageWrapper(Format);
-
-		if (!Wrapper.IsValid() || !Wrapper->SetCompressed(CompressedData, DataSize)) return nullptr;
+	AddTextureSlot(aiTextureType_DIFFUSE, "BaseColor", true);
+	AddTextureSlot(aiTextureType_BASE_COLOR, "BaseColor", true);
 
-		TArray64<uint8> RawData;
-		if (!Wrapper->GetRaw(ERGBFormat::BGRA, 8, RawData)) return nullptr;
+	AddTextureSlot(aiTextureType_NORMALS, "Normal", false);
+	AddTextureSlot(aiTextureType_NORMAL_CAMERA, "Normal", false);
+	AddTextureSlot(aiTextureType_HEIGHT, "Normal", false);
+	AddTextureSlot(aiTextureType_DISPLACEMENT, "Normal", false);
 
-		int32 Width = Wrapper->GetWidth();
-		int32 Height = Wrapper->GetHeight();
+	AddTextureSlot(aiTextureType_METALNESS, "Metallic", false);
+	// AddTextureSlot(aiTextureType_SPECULAR, "Metallic", false); // Sometimes specular is used for metal
 
-		Texture = UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8);
-		if (!Texture) return nullptr;
-#if WITH_EDITORONLY_DATA
-		Texture->MipGenSettings = TMGS_FromTextureGroup;
-#endif
-		Texture->NeverStream = true;
-
-		// --- SRGB / TextureGroup ---
-		if (Type == aiTextureType_DIFFUSE || Type == aiTextureType_BASE_COLOR || Type == aiTextureType_EMISSIVE)
-		{
-			Texture->SRGB = true;
-			Texture->LODGroup = TEXTUREGROUP_World;
-		}
-		else if (Type == aiTextureType_NORMALS || Type == aiTextureType_HEIGHT)
-		{
-			Texture->SRGB = false;
-			Texture->LODGroup = TEXTUREGROUP_WorldNormalMap;
-		}
-		else if (Type == aiTextureType_METALNESS || Type == aiTextureType_DIFFUSE_ROUGHNESS)
-		{
-			Texture->SRGB = false;
-			Texture->LODGroup = TEXTUREGROUP_WorldSpecular;
-		}
-		else if (Type == aiTextureType_AMBIENT_OCCLUSION || Type == aiTextureType_SPECULAR)
-		{
-			Texture->SRGB = false;
-			Texture->LODGroup = TEXTUREGROUP_World;
-		}
-		else
-		{
-			Texture->SRGB = false;
-			Texture->LODGroup = TEXTUREGROUP_World;
-		}
-
-		// --- Copy raw data ---
-		FTexture2DMipMap& Mip = Texture->GetPlatformData()->Mips[0];
-		void* TextureData = Mip.BulkData.Lock(LOCK_READ_WRITE);
-		FMemory::Memcpy(TextureData, RawData.GetData(), RawData.Num());
-		Mip.BulkData.Unlock();
-
-		Texture->UpdateResource();
-		Texture->SetFlags(RF_Transient);
 
-		UE_LOG(LogTemp, Display, TEXT("[%s] ✅ Loaded embedded texture for parameter %s: %s (%dx%d)"),
-			*MaterialName, *ParamName.ToString(), *DebugName, Width, Height);
-	}
-	else // --- Raw RGBA texture ---
-	{
-		int32 Width = EmbeddedTex->mWidth;
-		int32 Height = EmbeddedTex->mHeight;
-
-		Texture = UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8);
-#if WITH_EDITORONLY_DATA
-		Texture->MipGenSettings = TMGS_FromTextureGroup;
-#endif
-		Texture->NeverStream = true;
+	AddTextureSlot(aiTextureType_SPECULAR, "Specular", false);
 
-		// SRGB / TextureGroup
-		if (Type == aiTextureType_DIFFUSE || Type == aiTextureType_BASE_COLOR || Type == aiTextureType_EMISSIVE)
-		{
-			Texture->SRGB = true;
-			Texture->LODGroup = TEXTUREGROUP_World;
-		}
-		else if (Type == aiTextureType_NORMALS || Type == aiTextureType_HEIGHT)
-		{
-			Texture->SRGB = false;
-			Texture->LODGroup = TEXTUREGROUP_WorldNormalMap;
-		}
-		else if (Type == aiTextureType_METALNESS || Type == aiTextureType_DIFFUSE_ROUGHNESS)
-		{
-			Texture->SRGB = false;
-			Texture->LODGroup = TEXTUREGROUP_WorldSpecular;
-		}
-		else if (Type == aiTextureType_AMBIENT_OCCLUSION || Type == aiTextureType_SPECULAR)
-		{
-			Texture->SRGB = false;
-			Texture->LODGroup = TEXTUREGROUP_World;
-		}
-		else
-		{
-			Texture->SRGB = false;
-			Texture->LODGroup = TEXTUREGROUP_World;
-		}
 
-		void* TextureData = Texture->GetPlatformData()->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
-		FMemory::Memcpy(TextureData, EmbeddedTex->pcData, Width * Height * sizeof(FColor));
-		Texture->GetPlatformData()->Mips[0].BulkData.Unlock();
+	AddTextureSlot(aiTextureType_AMBIENT_OCCLUSION, "AmbientOcclusion", false);
+	AddTextureSlot(aiTextureType_AMBIENT, "AmbientOcclusion", false);
 
-		Texture->UpdateResource();
-		Texture->SetFlags(RF_Transient);
+	AddTextureSlot(aiTextureType_DIFFUSE_ROUGHNESS, "Roughness", false);
+	// AddTextureSlot(aiTextureType_SHININESS, "Roughness", false); // Shininess often contains roughness
 
-		UE_LOG(LogTemp, Display, TEXT("[%s] ✅ Loaded raw embedded texture for parameter %s: %s (%dx%d)"),
-			*MaterialName, *ParamName.ToString(), *DebugName, Width, Height);
-	}
 
-	return Texture;
-}
+	AddTextureSlot(aiTextureType_EMISSION_COLOR, "Emmisive", false);
+	AddTextureSlot(aiTextureType_EMISSIVE, "Emmisive", false);
 
 
+	AddTextureSlot(aiTextureType_OPACITY, "Opacity", false);
+}
 
-UTexture2D* UAssimpRuntime3DModelsImporter::LoadTextureFromDisk(
-	const FString& TexturePath,
-	const FString& MaterialName,
-	const FName& ParamName,
-	aiTextureType Type)
+UMaterialInstanceDynamic* UAssimpRuntime3DModelsImporter::CreateMaterialFromData(
+	const FModelMaterialData& MaterialData,
+	int32 MaterialIndex)
+{
+	int32 NextSlot = INDEX_NONE;
+	while (!CreateMaterialStep(MaterialData, MaterialIndex, NextSlot))
+	{
+	}
+	return MaterialCache.FindRef(MaterialIndex);
+}
+
+bool UAssimpRuntime3DModelsImporter::CreateMaterialStep(
+	const FModelMaterialData& MaterialData,
+	int32 MaterialIndex,
+	int32& NextSlot)
 {
-	if (!FPaths::FileExists(TexturePath)) return nullptr;
+	MODEL_IMPORT_SCOPE(CreateMaterial);
 
-	FString Extension = FPaths::GetExtension(TexturePath).ToLower();
+	const FString& MaterialNameStr = MaterialData.Name;
 
-	if (Extension == "dds")
+	if (NextSlot == INDEX_NONE)
 	{
-		return LoadDDSTexture(TexturePath, Type); // Keep existing DDS loader
-	}
+		// ----------------------------
+		// Cache check first!
+		// ----------------------------
+		if (MaterialCache.Contains(MaterialIndex))
+		{
+			UE_LOG(LogTemp, Log, TEXT("🔹 Using cached Material Instance: %s"), *MaterialNameStr);
+			return true;
+		}
+
+		// Only log creation if new
+		UE_LOG(LogTemp, Log, TEXT("🔹 Creating Material Instance: %s"), *MaterialNameStr);
+
+		if (!MasterMaterial)
+			LoadMasterMaterial();
+		if (!MasterMaterial)
+		{
+			UE_LOG(LogTemp, Error, TEXT("❌ No valid MasterMaterial loaded."));
+			return true;
+		}
 
-	TArray<uint8> FileData;
-	if (!FFileHelper::LoadFileToArray(FileData, *TexturePath)) return nullptr;
+		// Create dynamic instance
+		UMaterialInstanceDynamic* MatInstance = UMaterialInstanceDynamic::Create(MasterMaterial, GetTransientPackage());
+		if (!MatInstance)
+		{
+			UE_LOG(LogTemp, Error, TEXT("❌ Failed to create dynamic material instance."));
+			return true;
+		}
 
-	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>("ImageWrapper");
-	EImageFormat Format = ImageWrapperModule.DetectImageFormat(FileData.GetData(), FileData.Num());
-	if (Format == EImageFormat::Invalid) return nullptr;
+		LoadedMaterials.Add(MatInstance);
+		MaterialCache.Add(MaterialIndex, MatInstance);
 
-	TSharedPtr<IImageWrapper> Wrapper = ImageWrapperModule.CreateImageWrapper(Format);
-	if (!Wrapper.IsValid() || !Wrapper->SetCompressed(FileData.GetData(), FileData.Num())) return nullptr;
+		// Fallback BaseColor
+		if (MaterialData.bHasBaseColor)
+		{
+			const FLinearColor& Color = MaterialData.BaseColor;
+			MatInstance->SetVectorParameterValue("BaseColor", Color);
+			UE_LOG(LogTemp, Log, TEXT("   [%s] 🎨 Fallback Base Color: R=%.2f G=%.2f B=%.2f"),
+				*MaterialNameStr, Color.R, Color.G, Color.B);
+		}
 
-	TArray64<uint8> RawData;
-	if (!Wrapper->GetRaw(ERGBFormat::BGRA, 8, RawData)) return nullptr;
+		NextSlot = 0;
+		return false;
+	}
 
-	int32 Width = Wrapper->GetWidth();
-	int32 Height = Wrapper->GetHeight();
+	// ----------------------------
+	// Apply textures, one per step. DecodeTextures already picked the slot each parameter uses; the others carry no texels
+	// ----------------------------
+	while (MaterialData.Textures.IsValidIndex(NextSlot) && !MaterialData.Textures[NextSlot].Decoded.IsValid())
+	{
+		++NextSlot;
+	}
+	if (!MaterialData.Textures.IsValidIndex(NextSlot))
+	{
+		UE_LOG(LogTemp, Log, TEXT("🔹 Finished Material Instance: %s"), *MaterialNameStr);
+		return true;
+	}
 
-	UTexture2D* Texture = UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8);
-#if WITH_EDITORONLY_DATA
-	Texture->MipGenSettings = TMGS_FromTextureGroup;
-#endif
-	Texture->NeverStream = true;
+	const FModelTextureSlot& Slot = MaterialData.Textures[NextSlot++];
+	const FName& ParamName = Slot.ParamName;
+	UTexture2D* Texture = CreateTextureFromDecoded(*Slot.Decoded, static_cast<aiTextureType>(Slot.TextureType), MaterialNameStr, ParamName);
+	if (Texture)
+	{
+		const FString AppliedTextureName = Slot.EmbeddedData.Num() > 0 ? FString::Printf(TEXT("Embedded (%s)"), *Slot.SourcePath) : Slot.ResolvedPath;
+		Texture->SRGB = Slot.bIsColor;
+		MaterialCache[MaterialIndex]->SetTextureParameterValue(ParamName, Texture);
+		UE_LOG(LogTemp, Display, TEXT("   [%s] ✅ Texture applied: %s -> Parameter: %s"),
+			*MaterialNameStr, *AppliedTextureName, *ParamName.ToString());
+	}
+	return false;
+}
 
-	// SRGB / TextureGroup
+// --- SRGB / TextureGroup by the Assimp texture type ---
+static void ApplyTextureTypeSettings(UTexture2D* Texture, aiTextureType Type)
+{
 	if (Type == aiTextureType_DIFFUSE || Type == aiTextureType_BASE_COLOR || Type == aiTextureType_EMISSIVE)
 	{
 		Texture->SRGB = true;
@@ -623,162 +1633,62 @@ UTexture2D* UAssimpRuntime3DModelsImporter::LoadTextureFromDisk(
 		Texture->SRGB = false;
 		Texture->LODGroup = TEXTUREGROUP_WorldSpecular;
 	}
-	else if (Type == aiTextureType_AMBIENT_OCCLUSION || Type == aiTextureType_SPECULAR)
-	{
-		Texture->SRGB = false;
-		Texture->LODGroup = TEXTUREGROUP_World;
-	}
 	else
 	{
 		Texture->SRGB = false;
 		Texture->LODGroup = TEXTUREGROUP_World;
 	}
-
-	FTexture2DMipMap& Mip = Texture->GetPlatformData()->Mips[0];
-	void* TextureData = Mip.BulkData.Lock(LOCK_READ_WRITE);
-	FMemory::Memcpy(TextureData, RawData.GetData(), RawData.Num());
-	Mip.BulkData.Unlock();
-
-	Texture->UpdateResource();
-	Texture->SetFlags(RF_Transient);
-
-	UE_LOG(LogTemp, Display, TEXT("[%s] ✅ Loaded texture for parameter %s: %s (%dx%d)"),
-		*MaterialName, *ParamName.ToString(), *TexturePath, Width, Height);
-
-	return Texture;
 }
 
-
-UTexture2D* UAssimpRuntime3DModelsImporter::LoadDDSTexture(
-	const FString& DDSTexture,
-	aiTextureType Type // New: pass texture type to handle SRGB correctly
-)
+UTexture2D* UAssimpRuntime3DModelsImporter::CreateTextureFromDecoded(
+	const FModelDecodedTexture& Decoded,
+	aiTextureType Type,
+	const FString& MaterialName,
+	const FName& ParamName)
 {
-	if (!FPaths::FileExists(DDSTexture))
-	{
-		UE_LOG(LogTemp, Error, TEXT("❌ DDS file not found: %s"), *DDSTexture);
-		return nullptr;
-	}
-
-	// Load DDS using DirectXTex
-	DirectX::ScratchImage ScratchImage;
-	std::wstring WPath = *DDSTexture;
-	HRESULT Hr = DirectX::LoadFromDDSFile(WPath.c_str(), DirectX::DDS_FLAGS_NONE, nullptr, ScratchImage);
-	if (FAILED(Hr))
-	{
-		UE_LOG(LogTemp, Error, TEXT("❌ Failed to load DDS file: %s"), *DDSTexture);
-		return nullptr;
-	}
-
-	const DirectX::TexMetadata& Meta = ScratchImage.GetMetadata();
-	const DXGI_FORMAT TargetFormat = DXGI_FORMAT_B8G8R8A8_UNORM;
-
-	DirectX::ScratchImage FinalImage;
-	const bool bNeedsDecompress = DirectX::IsCompressed(Meta.format);
-	const bool bNeedsConvert = Meta.format != TargetFormat;
-
-	if (bNeedsDecompress)
-	{
-		Hr = DirectX::Decompress(ScratchImage.GetImages(), ScratchImage.GetImageCount(), Meta, TargetFormat, FinalImage);
-	}
-	else if (bNeedsConvert)
-	{
-		Hr = DirectX::Convert(ScratchImage.GetImages(), ScratchImage.GetImageCount(), Meta, TargetFormat, DirectX::TEX_FILTER_DEFAULT, 0.f, FinalImage);
-	}
-	else
-	{
-		FinalImage = std::move(ScratchImage);
-		Hr = S_OK;
-	}
-
-	if (FAILED(Hr))
-	{
-		UE_LOG(LogTemp, Error, TEXT("❌ Failed to convert DDS to target format: %s"), *DDSTexture);
-		return nullptr;
-	}
-
-	const DirectX::TexMetadata& FinalMeta = FinalImage.GetMetadata();
-	const uint32 Width = static_cast<uint32>(FinalMeta.width);
-	const uint32 Height = static_cast<uint32>(FinalMeta.height);
-	const uint32 MipLevels = static_cast<uint32>(FinalMeta.mipLevels);
+	MODEL_IMPORT_SCOPE(CreateTexture);
 
-	// Create Unreal texture
-	UTexture2D* Texture = UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8);
+	// Texels were decoded on the import worker; only the copy into bulk data and the upload are left for the GameThread
+	const FModelDecodedTexture::FMip& TopMip = Decoded.Mips[0];
+	UTexture2D* Texture = UTexture2D::CreateTransient(TopMip.SizeX, TopMip.SizeY, PF_B8G8R8A8);
 	if (!Texture)
 	{
-		UE_LOG(LogTemp, Error, TEXT("❌ Failed to create texture: %s"), *DDSTexture);
+		UE_LOG(LogTemp, Error, TEXT("[%s] ❌ Failed to create texture for parameter %s (%dx%d)"),
+			*MaterialName, *ParamName.ToString(), TopMip.SizeX, TopMip.SizeY);
 		return nullptr;
 	}
 
 	FTexturePlatformData* PlatformData = Texture->GetPlatformData();
 	PlatformData->Mips.Empty();
-	PlatformData->SizeX = Width;
-	PlatformData->SizeY = Height;
-	PlatformData->PixelFormat = PF_B8G8R8A8;
-
-	// Copy all mip levels
-	for (uint32 MipIndex = 0; MipIndex < MipLevels; ++MipIndex)
+	for (const FModelDecodedTexture::FMip& DecodedMip : Decoded.Mips)
 	{
-		const DirectX::Image* MipImage = FinalImage.GetImage(MipIndex, 0, 0);
-		if (!MipImage || !MipImage->pixels)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("⚠️ Skipping invalid mip level %u for texture %s"), MipIndex, *DDSTexture);
-			continue;
-		}
-
 		FTexture2DMipMap* Mip = new FTexture2DMipMap();
-		Mip->SizeX = MipImage->width;
-		Mip->SizeY = MipImage->height;
+		Mip->SizeX = DecodedMip.SizeX;
+		Mip->SizeY = DecodedMip.SizeY;
 
 		Mip->BulkData.Lock(LOCK_READ_WRITE);
-		void* Dest = Mip->BulkData.Realloc(MipImage->slicePitch);
-		FMemory::Memcpy(Dest, MipImage->pixels, MipImage->slicePitch);
+		void* Dest = Mip->BulkData.Realloc(DecodedMip.Data.Num());
+		FMemory::Memcpy(Dest, DecodedMip.Data.GetData(), DecodedMip.Data.Num());
 		Mip->BulkData.Unlock();
 
 		PlatformData->Mips.Add(Mip);
 	}
 
-	// --- Set SRGB / TextureGroup based on type ---
-	if (Type == aiTextureType_DIFFUSE || Type == aiTextureType_BASE_COLOR || Type == aiTextureType_EMISSIVE)
-	{
-		Texture->SRGB = true;
-		Texture->LODGroup = TEXTUREGROUP_World;
-	}
-	else if (Type == aiTextureType_NORMALS || Type == aiTextureType_HEIGHT)
-	{
-		Texture->SRGB = false;
-		Texture->LODGroup = TEXTUREGROUP_WorldNormalMap;
-	}
-	else if (Type == aiTextureType_METALNESS || Type == aiTextureType_DIFFUSE_ROUGHNESS)
-	{
-		Texture->SRGB = false;
-		Texture->LODGroup = TEXTUREGROUP_WorldSpecular;
-	}
-	else if (Type == aiTextureType_AMBIENT_OCCLUSION || Type == aiTextureType_SPECULAR)
-	{
-		Texture->SRGB = false;
-		Texture->LODGroup = TEXTUREGROUP_World;
-	}
-	else
-	{
-		Texture->SRGB = false;
-		Texture->LODGroup = TEXTUREGROUP_World;
-	}
-
+	ApplyTextureTypeSettings(Texture, Type);
 #if WITH_EDITORONLY_DATA
-	Texture->MipGenSettings = TMGS_NoMipmaps; // Already using loaded mips
+	Texture->MipGenSettings = Decoded.Mips.Num() > 1 ? TMGS_NoMipmaps : TMGS_FromTextureGroup; // A DDS brings its own mips
 #endif
 	Texture->NeverStream = true;
 
 	Texture->UpdateResource();
-	Texture->AddToRoot(); // prevent GC
+	Texture->SetFlags(RF_Transient);
 
-	UE_LOG(LogTemp, Display, TEXT("✅ DDS loaded: %s (%dx%d, Mips=%d, Type=%d)"), *DDSTexture, Width, Height, MipLevels, (int32)Type);
+	UE_LOG(LogTemp, Display, TEXT("[%s] ✅ Created texture for parameter %s (%dx%d, Mips=%d)"),
+		*MaterialName, *ParamName.ToString(), TopMip.SizeX, TopMip.SizeY, Decoded.Mips.Num());
 
 	return Texture;
 }
 
-
 bool UAssimpRuntime3DModelsImporter::IsVectorFinite(const FVector& Vec)
 {
 	return FMath::IsFinite(Vec.X) && FMath::IsFinite(Vec.Y) && FMath::IsFinite(Vec.Z);
@@ -825,43 +1735,440 @@ AActor* UAssimpRuntime3DModelsImporter::GetNodeActorByName(const FString& NodeNa
 	return nullptr;
 }
 
-void UAssimpRuntime3DModelsImporter::ImportModel(const FString& InFilePath)
+USceneComponent* UAssimpRuntime3DModelsImporter::GetNodeComponentByName(const FString& NodeName) const
+{
+	USceneComponent* const* NodeComponent = SpawnedNodeComponents.Find(NodeName);
+	return NodeComponent ? *NodeComponent : nullptr;
+}
+
+TFuture<bool> UAssimpRuntime3DModelsImporter::ImportModel(const FString& InFilePath)
+{
+	return ImportModel(InFilePath, ImportSettings);
+}
+
+TFuture<bool> UAssimpRuntime3DModelsImporter::ImportModel(const FString& InFilePath, const FModelImportSettings& InSettings)
+{
+	check(IsInGameThread());
+
+	// Only one import per importer; a newer request supersedes the old one
+	CancelImport();
+	MaterialCache.Empty(); // May hold materials a superseded time-sliced commit got partway through
+	FModelTextureDecoder::LoadModules();
+
+	FilePath = InFilePath;
+	ModelName = FPaths::GetBaseFilename(FilePath);
+
+	TSharedRef<FModelImportTask> Task = MakeShared<FModelImportTask>();
+	Task->FilePath = InFilePath;
+	Task->Settings = InSettings;
+	Task->Profiler = MakeShared<FModelImportProfiler>(InFilePath);
+	Task->StartTime = FPlatformTime::Seconds();
+	ImportSettings = InSettings;
+	ActiveImport = Task;
+	TFuture<bool> Future = Task->Promise.GetFuture();
+
+	TWeakObjectPtr<UAssimpRuntime3DModelsImporter> WeakThis(this);
+	TWeakPtr<FModelImportTask> WeakTask = Task;
+
+	// Worker stages report here; listeners only hear about the import this importer is still waiting for
+	Task->OnProgress = [WeakThis, WeakTask](float Progress, EModelImportStage Stage)
+		{
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, WeakTask, Progress, Stage]()
+				{
+					UAssimpRuntime3DModelsImporter* Importer = WeakThis.Get();
+					TSharedPtr<FModelImportTask> PinnedTask = WeakTask.Pin();
+					if (Importer && PinnedTask && Importer->ActiveImport == PinnedTask && !PinnedTask->IsCancelled())
+					{
+						Importer->OnImportProgress.Broadcast(Importer, Progress, GetModelImportStageName(Stage));
+					}
+				});
+		};
+
+	// Stages run back to back on one background worker of the (work-stealing) task scheduler;
+	// each one bails out early if the import was cancelled
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Task, WeakThis]()
+		{
+			FModelImportProfiler::FScopedContext ProfilerContext(Task->Profiler.Get());
+
+			// A valid cache entry replaces both ReadFile and extraction
+			const bool bParsed =
+				ReadSourceFile(*Task) &&
+				(LoadCachedSceneData(*Task) || (ReadScene(*Task) && ExtractSceneData(*Task))) &&
+				DecodeTextures(*Task) &&
+				BuildMeshDescriptions(*Task) &&
+				BuildCollisionHulls(*Task) &&
+				DecomposeCollision(*Task);
+
+			if (!bParsed)
+			{
+				// Failed or cancelled: give the scene, the mapped files and the partial extraction back now
+				// rather than after the GameThread gets around to the completion
+				Task->ReleaseScene();
+				Task->Meshes.Empty();
+				Task->MeshDescriptions.Empty();
+				Task->CollisionHulls.Empty();
+				Task->ConvexDecompositions.Empty();
+				Task->RootNode = FModelNodeData();
+				Task->Materials.Empty();
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [Task, WeakThis, bParsed]()
+				{
+					UAssimpRuntime3DModelsImporter* Importer = WeakThis.Get();
+					const bool bOwnedByImporter = Importer && Importer->ActiveImport.Get() == &Task.Get();
+					const bool bCommit = bParsed && bOwnedByImporter && !Task->IsCancelled();
+					if (bCommit && Task->Settings.bTimeSliceCommit)
+					{
+						Importer->ScheduleCommit(Task);
+						return;
+					}
+
+					bool bSuccess = false;
+					{
+						FModelImportProfiler::FScopedContext ProfilerContext(Task->Profiler.Get());
+						bSuccess = bCommit && Importer->CommitImport(*Task);
+					}
+					FinishImport(Task, WeakThis, bSuccess);
+				});
+		}, UE::Tasks::ETaskPriority::BackgroundNormal);
+
+	return Future;
+}
+
+void UAssimpRuntime3DModelsImporter::FinishImport(const TSharedRef<FModelImportTask>& Task, TWeakObjectPtr<UAssimpRuntime3DModelsImporter> WeakThis, bool bSuccess)
 {
+	UAssimpRuntime3DModelsImporter* Importer = WeakThis.Get();
+	const bool bOwnedByImporter = Importer && Importer->ActiveImport.Get() == &Task.Get();
 
-	Async(EAsyncExecution::ThreadPool ,[this, InFilePath]()
+	const double TotalSeconds = FPlatformTime::Seconds() - Task->StartTime;
+	Task->Profiler->Update([bSuccess, TotalSeconds](FModelImportTimings& Timings)
 		{
+			Timings.bSuccess = bSuccess;
+			Timings.TotalSeconds = TotalSeconds;
+		});
+
+	Task->ReleaseScene();
+	Task->Materials.Empty(); // Decoded texels are uploaded (or no longer wanted) by now
+	if (bOwnedByImporter)
+	{
+		Importer->ActiveImport.Reset();
+		Importer->LastImportProfiler = Task->Profiler; // Spawning adds to the same record
+	}
+
+	if (Task->IsCancelled())
+		UE_LOG(LogTemp, Log, TEXT("🔹 Import cancelled: %s"), *Task->FilePath);
+
+	Task->Promise.SetValue(bSuccess);
+	if (bOwnedByImporter)
+	{
+		Importer->OnImportCompleted.Broadcast(Importer, bSuccess);
+	}
+}
+
+void UAssimpRuntime3DModelsImporter::CancelImport()
+{
+	if (ActiveImport.IsValid())
+	{
+		ActiveImport->bCancelled = true;
+		ActiveImport.Reset();
+	}
+}
+
+bool UAssimpRuntime3DModelsImporter::ReadSourceFile(FModelImportTask& Task)
+{
+	if (Task.IsCancelled()) return false;
+	Task.ReportProgress(EModelImportStage::Reading, 0.f);
+	MODEL_IMPORT_SCOPE(SourceRead);
+
+	// Every read Assimp makes (model plus sidecars like .mtl/.bin) goes through mapped regions, no heap copy
+	Task.Importer = FAssimpImporterPool::Get().Acquire();
+	Task.IOSystem = new FAssimpMappedIOSystem();
+	Task.Importer->SetIOHandler(Task.IOSystem); // Importer takes ownership
+
+	if (!Task.IOSystem->Preload(Task.FilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Failed to read model file: %s"), *Task.FilePath);
+		return false;
+	}
+
+	TSharedPtr<FAssimpMappedFile> SourceFile = Task.IOSystem->MapFile(Task.FilePath);
+	Task.SourceHash = FModelImportCache::HashSourceFile(SourceFile->GetData(), SourceFile->GetSize());
+	Task.Profiler->Update([Size = SourceFile->GetSize()](FModelImportTimings& Timings) { Timings.SourceBytes = Size; });
+	Task.ReportProgress(EModelImportStage::Reading, 1.f);
+	return !Task.IsCancelled();
+}
+
+bool UAssimpRuntime3DModelsImporter::LoadCachedSceneData(FModelImportTask& Task)
+{
+	if (Task.IsCancelled() || !Task.Settings.bUseModelCache) return false;
+
+	Task.ReportProgress(EModelImportStage::LoadingCache, 0.f);
+	{
+		MODEL_IMPORT_SCOPE(LoadCache);
+		Task.bLoadedFromCache = FModelImportCache::Load(Task.FilePath, Task.SourceHash, Task.Settings.GetCacheKey(), Task.RootNode, Task.Materials);
+	}
+	if (Task.bLoadedFromCache)
+	{
+		Task.ReleaseScene(); // Nothing left to read through Assimp
+		Task.ReportProgress(EModelImportStage::LoadingCache, 1.f);
+	}
+	return Task.bLoadedFromCache;
+}
+
+bool UAssimpRuntime3DModelsImporter::ReadScene(FModelImportTask& Task)
+{
+	if (Task.IsCancelled()) return false;
+
+	FString AssimpPath = Task.FilePath;
+	FPaths::NormalizeFilename(AssimpPath);
+	Task.ReportProgress(EModelImportStage::Parsing, 0.f);
+	Task.Importer->SetProgressHandler(new FAssimpImportProgressHandler(Task)); // Importer takes ownership, the pool drops it on release
+	FModelImportProfiler::ConfigureAssimpProfiling(*Task.Importer, Task.Settings.bCaptureAssimpProfile);
+	{
+		MODEL_IMPORT_SCOPE(ReadFile);
+		Task.Scene = Task.Importer->ReadFile(TCHAR_TO_UTF8(*AssimpPath), Task.Settings.GetReadFileFlags());
+	}
+
+	// A loader that saw the handler return false has already given up; anything else finished ReadFile
+	// (postprocess cannot be interrupted), and the caller frees the scene right away
+	if (Task.IsCancelled()) return false;
+
+	if (!Task.Scene || !Task.Scene->mRootNode)
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Failed to load FBX: %s (%s)"), *Task.FilePath, UTF8_TO_TCHAR(Task.Importer->GetErrorString()));
+		return false;
+	}
+	return true;
+}
+
+bool UAssimpRuntime3DModelsImporter::ExtractSceneData(FModelImportTask& Task)
+{
+	if (Task.IsCancelled()) return false;
+
+	DebugAllTexturesInScene(Task.Scene, Task.FilePath);
+	ExtractMeshes(Task);
+	if (Task.IsCancelled()) return false;
+	{
+		MODEL_IMPORT_SCOPE(ParseNode);
+		ParseNode(Task.Scene->mRootNode, Task.Scene, Task.RootNode, Task);
+	}
+	Task.Meshes.Empty(); // The node tree holds the only references now
+
+	Task.Materials.SetNum(Task.Scene->mNumMaterials);
+	for (uint32 i = 0; i < Task.Scene->mNumMaterials && !Task.IsCancelled(); ++i)
+	{
+		ExtractMaterial(Task.Scene->mMaterials[i], Task.Scene, Task.Materials[i], Task.FilePath);
+	}
+
+	// Everything the commit needs is extracted now, so the aiScene can go before we hop to the GameThread
+	Task.ReleaseScene();
+	if (Task.IsCancelled()) return false;
+
+	if (Task.Settings.bUseModelCache)
+	{
+		MODEL_IMPORT_SCOPE(SaveCache);
+		FModelImportCache::Save(Task.FilePath, Task.SourceHash, Task.Settings.GetCacheKey(), Task.RootNode, Task.Materials);
+	}
+	return true;
+}
+
+bool UAssimpRuntime3DModelsImporter::DecodeTextures(FModelImportTask& Task)
+{
+	if (Task.IsCancelled()) return false;
+	MODEL_IMPORT_SCOPE(TextureDecode);
 
-			FilePath = InFilePath;
-			ModelName = FPaths::GetBaseFilename(FilePath);
+	// Only materials a section uses get built, so only their textures are worth decoding
+	TSet<int32> UsedMaterials;
+	CollectMaterialIndices(Task.RootNode, UsedMaterials);
+	const TArray<int32> MaterialIndices = UsedMaterials.Array();
 
-			Assimp::Importer Importer;
-			const aiScene* Scene = Importer.ReadFile(TCHAR_TO_UTF8(*FilePath),
-				aiProcess_Triangulate |
-				aiProcess_GenNormals |
-				aiProcess_CalcTangentSpace |
-				aiProcess_JoinIdenticalVertices |
-				aiProcess_ImproveCacheLocality |
-				aiProcess_OptimizeMeshes |
-				aiProcess_FlipUVs);
+	FModelImportProfiler* Profiler = FModelImportProfiler::GetCurrent();
+	ParallelFor(MaterialIndices.Num(), [&](int32 i)
+		{
+			if (Task.IsCancelled() || !Task.Materials.IsValidIndex(MaterialIndices[i])) return;
+			FModelImportProfiler::FScopedContext ProfilerContext(Profiler);
+			FModelMaterialData& Material = Task.Materials[MaterialIndices[i]];
 
-			if (!Scene || !Scene->mRootNode)
+			// Slots are in priority order: the first one that decodes takes its parameter
+			TSet<FName> DecidedParameters;
+			for (FModelTextureSlot& Slot : Material.Textures)
 			{
-				UE_LOG(LogTemp, Error, TEXT("❌ Failed to load FBX: %s"), *FilePath);
-				return;
+				if (DecidedParameters.Contains(Slot.ParamName))
+					continue;
+
+				TSharedPtr<FModelDecodedTexture> Decoded = MakeShared<FModelDecodedTexture>();
+				if (FModelTextureDecoder::Decode(Slot, *Decoded))
+				{
+					Slot.Decoded = Decoded;
+					DecidedParameters.Add(Slot.ParamName);
+				}
+			}
+
+			for (const FModelTextureSlot& Slot : Material.Textures)
+			{
+				bool bAlreadyDecided = false;
+				DecidedParameters.Add(Slot.ParamName, &bAlreadyDecided);
+				if (!bAlreadyDecided)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("   [%s] ⚠️ Texture not found for Parameter: %s"),
+						*Material.Name, *Slot.ParamName.ToString());
+				}
 			}
-			DebugAllTexturesInScene(Scene, FilePath);
-			TempScene = Scene;
-				UE_LOG(LogTemp, Error, TEXT("khdsjfifpkfoihfpwfjfpon"));
 		});
-			AsyncTask(ENamedThreads::GameThread, [this, TempScene=MoveTemp(TempScene)]()
+
+	return !Task.IsCancelled();
+}
+
+void UAssimpRuntime3DModelsImporter::CollectMaterialIndices(const FModelNodeData& Node, TSet<int32>& OutIndices)
+{
+	for (const TSharedPtr<FModelMeshData>& Section : Node.MeshSections)
+	{
+		OutIndices.Add(Section->MaterialIndex);
+	}
+	for (const FModelNodeData& Child : Node.Children)
+	{
+		CollectMaterialIndices(Child, OutIndices);
+	}
+}
+
+void UAssimpRuntime3DModelsImporter::ScheduleCommit(const TSharedRef<FModelImportTask>& Task)
+{
+	check(IsInGameThread());
+
+	float CommitStart, CommitEnd;
+	GetStageRange(EModelImportStage::Committing, CommitStart, CommitEnd);
+	OnImportProgress.Broadcast(this, CommitStart, GetModelImportStageName(EModelImportStage::Committing));
+
+	// Materials are built ahead of CommitImport, an instance or a single texture per step, into MaterialCache;
+	// CommitImport itself then only resolves sections against the cache, which is cheap enough for one frame
+	TSet<int32> MaterialIndices;
+	CollectMaterialIndices(Task->RootNode, MaterialIndices);
+	MaterialCache.Empty();
+
+	TWeakObjectPtr<UAssimpRuntime3DModelsImporter> WeakThis(this);
+	FModelGameThreadScheduler& Scheduler = FModelGameThreadScheduler::Get();
+	const EModelWorkPriority Priority = Task->Settings.CommitPriority;
+	int32 NumScheduled = 0;
+	for (int32 MaterialIndex : MaterialIndices)
+	{
+		if (!Task->Materials.IsValidIndex(MaterialIndex))
+			continue;
+
+		const float Progress = FMath::Lerp(CommitStart, CommitEnd, static_cast<float>(++NumScheduled) / (MaterialIndices.Num() + 1));
+		Scheduler.Enqueue(Priority, [WeakThis, Task, MaterialIndex, Progress, NextSlot = int32(INDEX_NONE)]() mutable
+			{
+				// Superseded or cancelled: nothing to build, the last step below settles the promise
+				UAssimpRuntime3DModelsImporter* Importer = WeakThis.Get();
+				if (!Importer || Importer->ActiveImport.Get() != &Task.Get() || Task->IsCancelled())
 				{
-					RootNode = FModelNodeData();
-					if(TempScene)
-					ParseNode(TempScene->mRootNode, TempScene, RootNode, FilePath);
-					// Perform any operations that need to be done on the main thread
-					// For example, updating the UI or logging success
-					UE_LOG(LogTemp, Log, TEXT("Model Import completed."));
-				});
+					return true;
+				}
+
+				FModelImportProfiler::FScopedContext ProfilerContext(Task->Profiler.Get());
+				if (!Importer->CreateMaterialStep(Task->Materials[MaterialIndex], MaterialIndex, NextSlot))
+				{
+					return false;
+				}
+				Importer->OnImportProgress.Broadcast(Importer, Progress, GetModelImportStageName(EModelImportStage::Committing));
+				return true;
+			});
+	}
+
+	// Same queue, so it runs after every material step
+	Scheduler.Enqueue(Priority, [WeakThis, Task]()
+		{
+			UAssimpRuntime3DModelsImporter* Importer = WeakThis.Get();
+			bool bSuccess = false;
+			if (Importer && Importer->ActiveImport.Get() == &Task.Get() && !Task->IsCancelled())
+			{
+				FModelImportProfiler::FScopedContext ProfilerContext(Task->Profiler.Get());
+				bSuccess = Importer->CommitImport(*Task);
+			}
+			FinishImport(Task, WeakThis, bSuccess);
+			return true;
+		});
+}
+
+bool UAssimpRuntime3DModelsImporter::CommitImport(FModelImportTask& Task)
+{
+	check(IsInGameThread());
+	MODEL_IMPORT_SCOPE(Commit);
+
+	float CommitStart, CommitEnd;
+	GetStageRange(EModelImportStage::Committing, CommitStart, CommitEnd);
+	OnImportProgress.Broadcast(this, CommitStart, GetModelImportStageName(EModelImportStage::Committing));
+	ResolveMaterialsRecursive(Task.RootNode, Task.Materials);
+	// Keeps only this import's materials alive for the sections that reference them; earlier imports' (and a superseded
+	// commit's) go to GC once nothing spawned uses them
+	MaterialCache.GenerateValueArray(LoadedMaterials);
+	MaterialCache.Empty(); // Keyed by material index, only valid for this import
+	StaticMeshCache.Empty(); // Keyed by section, which the new RootNode replaces
+	BuiltStaticMeshes.Empty();
+	Template.Reset(); // Its parts are the static meshes just dropped; instances placed from it stay in the world
+	PendingMeshDescriptions = MoveTemp(Task.MeshDescriptions);
+	CollisionHulls = MoveTemp(Task.CollisionHulls);
+	ConvexDecompositions = MoveTemp(Task.ConvexDecompositions);
+	StaticMeshSections.Empty();
+	CpuAccessibleMeshes.Empty();
+	RootNode = MoveTemp(Task.RootNode);
+	++CommitSerial;
+	OnImportProgress.Broadcast(this, CommitEnd, GetModelImportStageName(EModelImportStage::Committing));
+
+	Task.Profiler->Update([this, &Task](FModelImportTimings& Timings)
+		{
+			Timings.bLoadedFromCache = Task.bLoadedFromCache;
+			Timings.NumMaterials = Task.Materials.Num();
+			TSet<const FModelMeshData*> CountedMeshes;
+			CountMeshData(RootNode, Timings, CountedMeshes);
+		});
+
+	UE_LOG(LogTemp, Log, TEXT("Model Import completed."));
+	return true;
+}
+
+void UAssimpRuntime3DModelsImporter::CountMeshData(const FModelNodeData& Node, FModelImportTimings& Timings, TSet<const FModelMeshData*>& CountedMeshes)
+{
+	// Sections count every reference, geometry counts each shared mesh once
+	for (const TSharedPtr<FModelMeshData>& Section : Node.MeshSections)
+	{
+		++Timings.NumMeshSections;
+
+		bool bAlreadyCounted = false;
+		CountedMeshes.Add(Section.Get(), &bAlreadyCounted);
+		if (!bAlreadyCounted)
+		{
+			++Timings.NumUniqueMeshes;
+			Timings.NumVertices += Section->GetNumVertices();
+			Timings.NumTriangles += Section->GetNumTriangles();
+		}
+	}
+
+	for (const FModelNodeData& Child : Node.Children)
+	{
+		CountMeshData(Child, Timings, CountedMeshes);
+	}
+}
+
+FModelImportTimings UAssimpRuntime3DModelsImporter::GetLastImportTimings() const
+{
+	return LastImportProfiler.IsValid() ? LastImportProfiler->GetTimings() : FModelImportTimings();
+}
+
+void UAssimpRuntime3DModelsImporter::ResolveMaterialsRecursive(FModelNodeData& Node, const TArray<FModelMaterialData>& Materials)
+{
+	for (const TSharedPtr<FModelMeshData>& Section : Node.MeshSections)
+	{
+		// Shared sections come through here once per reference; MaterialCache makes the repeats a lookup
+		if (Materials.IsValidIndex(Section->MaterialIndex))
+		{
+			Section->Material = CreateMaterialFromData(Materials[Section->MaterialIndex], Section->MaterialIndex);
+		}
+	}
+
+	for (FModelNodeData& Child : Node.Children)
+	{
+		ResolveMaterialsRecursive(Child, Materials);
+	}
 }
 
 void UAssimpRuntime3DModelsImporter::HideModel()
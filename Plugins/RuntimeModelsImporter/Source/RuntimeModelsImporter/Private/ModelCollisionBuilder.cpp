@@ -0,0 +1,113 @@
+// Cheap simple collision for imported sections: bounding boxes and extreme-point convex hulls instead of cooking every triangle
+#include "ModelCollisionBuilder.h"
+#include "ModelMeshData.h"
+#include "ModelImportProfiler.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Algo/Sort.h"
+#include "Algo/Unique.h"
+
+// Evenly spread unit directions (Fibonacci sphere), built once
+const TArray<FVector>& FModelCollisionBuilder::GetHullDirections()
+{
+	static const TArray<FVector> Directions = []()
+		{
+			TArray<FVector> Result;
+			Result.Reserve(NumDirections);
+			const double GoldenAngle = UE_DOUBLE_PI * (3.0 - FMath::Sqrt(5.0));
+			for (int32 i = 0; i < NumDirections; ++i)
+			{
+				const double Z = 1.0 - 2.0 * (i + 0.5) / NumDirections;
+				const double Radius = FMath::Sqrt(1.0 - Z * Z);
+				Result.Add(FVector(Radius * FMath::Cos(GoldenAngle * i), Radius * FMath::Sin(GoldenAngle * i), Z));
+			}
+			return Result;
+		}();
+	return Directions;
+}
+
+void FModelCollisionBuilder::BuildConvexHullPoints(const FModelMeshData& Section, TArray<FVector>& OutPoints)
+{
+	BuildConvexHullPoints(Section.GetNumVertices(), [&Section](int32 Index) { return FVector(Section.GetPosition(Index)); }, OutPoints);
+}
+
+void FModelCollisionBuilder::BuildConvexHullPoints(int32 NumPoints, TFunctionRef<FVector(int32)> GetPoint, TArray<FVector>& OutPoints)
+{
+	MODEL_IMPORT_SCOPE(BuildCollisionHull);
+
+	OutPoints.Reset();
+	if (NumPoints == 0)
+	{
+		return;
+	}
+
+	const TArray<FVector>& Directions = GetHullDirections();
+	double BestDots[NumDirections];
+	int32 BestIndices[NumDirections];
+	for (int32 d = 0; d < NumDirections; ++d)
+	{
+		BestDots[d] = TNumericLimits<double>::Lowest();
+		BestIndices[d] = 0;
+	}
+
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		const FVector Point = GetPoint(Index);
+		for (int32 d = 0; d < NumDirections; ++d)
+		{
+			const double Dot = FVector::DotProduct(Point, Directions[d]);
+			if (Dot > BestDots[d])
+			{
+				BestDots[d] = Dot;
+				BestIndices[d] = Index;
+			}
+		}
+	}
+
+	// Neighbouring directions often end on the same point
+	TArray<int32, TInlineAllocator<NumDirections>> Unique(BestIndices, NumDirections);
+	Algo::Sort(Unique);
+	Unique.SetNum(Algo::Unique(Unique));
+	for (int32 Index : Unique)
+	{
+		OutPoints.Add(GetPoint(Index));
+	}
+}
+
+void FModelCollisionBuilder::GetBoxPoints(const FBox& Box, TArray<FVector>& OutPoints)
+{
+	OutPoints.Reset(8);
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		OutPoints.Add(FVector(
+			(Corner & 1) ? Box.Max.X : Box.Min.X,
+			(Corner & 2) ? Box.Max.Y : Box.Min.Y,
+			(Corner & 4) ? Box.Max.Z : Box.Min.Z));
+	}
+}
+
+void FModelCollisionBuilder::SetBoxCollision(UBodySetup* BodySetup, const FBox& Box)
+{
+	BodySetup->RemoveSimpleCollision();
+
+	const FVector Size = Box.GetSize();
+	FKBoxElem BoxElem(Size.X, Size.Y, Size.Z);
+	BoxElem.Center = Box.GetCenter();
+	BodySetup->AggGeom.BoxElems.Add(BoxElem);
+}
+
+int32 FModelCollisionBuilder::SetConvexCollision(UBodySetup* BodySetup, TArrayView<const TArray<FVector>> Hulls)
+{
+	BodySetup->RemoveSimpleCollision();
+
+	for (const TArray<FVector>& HullPoints : Hulls)
+	{
+		if (HullPoints.Num() >= MinHullPoints)
+		{
+			FKConvexElem ConvexElem;
+			ConvexElem.VertexData = HullPoints;
+			ConvexElem.UpdateElemBox();
+			BodySetup->AggGeom.ConvexElems.Add(MoveTemp(ConvexElem));
+		}
+	}
+	return BodySetup->AggGeom.ConvexElems.Num();
+}
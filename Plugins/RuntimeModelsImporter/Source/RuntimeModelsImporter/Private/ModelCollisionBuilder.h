@@ -0,0 +1,32 @@
+// Cheap simple collision for imported sections: bounding boxes and extreme-point convex hulls instead of cooking every triangle
+#pragma once
+#include "CoreMinimal.h"
+
+struct FModelMeshData;
+class UBodySetup;
+
+class FModelCollisionBuilder
+{
+public:
+    // The points furthest along each of NumDirections directions spread over the sphere. Their convex hull wraps the
+    // mesh closely with at most NumDirections vertices, so cooking it costs next to nothing. Touches no UObjects
+    static void BuildConvexHullPoints(const FModelMeshData& Section, TArray<FVector>& OutPoints);
+    static void BuildConvexHullPoints(int32 NumPoints, TFunctionRef<FVector(int32)> GetPoint, TArray<FVector>& OutPoints);
+
+    // The 8 corners of Box, for components that only take convex collision (procedural meshes)
+    static void GetBoxPoints(const FBox& Box, TArray<FVector>& OutPoints);
+
+    // Replace the simple shapes of BodySetup; cooking is left to the caller. SetConvexCollision skips hulls with too few
+    // points and returns how many it added, 0 leaving the caller to fall back to the box
+    static void SetBoxCollision(UBodySetup* BodySetup, const FBox& Box);
+    static int32 SetConvexCollision(UBodySetup* BodySetup, TArrayView<const TArray<FVector>> Hulls);
+
+    // The directions BuildConvexHullPoints searches along
+    static const TArray<FVector>& GetHullDirections();
+
+    // Fewer hull points than this cannot enclose a volume; callers fall back to the bounding box
+    static constexpr int32 MinHullPoints = 4;
+
+private:
+    static constexpr int32 NumDirections = 64;
+};
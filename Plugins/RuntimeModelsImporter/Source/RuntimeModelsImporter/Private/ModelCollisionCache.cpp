@@ -0,0 +1,168 @@
+// Convex decompositions persisted next to the source file (<file>.collision), so each model is decomposed once rather than per import
+#include "ModelCollisionCache.h"
+#include "AssimpRuntime3DModelsImporter.h"
+#include "Hash/xxhash.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// File layout: fixed header, then one payload blob checked by PayloadHash.
+// The payload holds, per section in CollectSections order, its vertex count (a cheap check that the sections match) and its hulls
+static constexpr uint32 CollisionCacheMagic = 0x434C4D41; // 'AMLC'
+
+struct FCollisionCacheHeader
+{
+	uint32 Magic = CollisionCacheMagic;
+	uint32 FormatVersion = FModelCollisionCache::FormatVersion;
+	uint32 DecompositionVersion = FModelCollisionCache::DecompositionVersion;
+	uint64 CollisionKey = 0;
+	uint64 SourceHash = 0;
+	int64 PayloadSize = 0;
+	uint64 PayloadHash = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FCollisionCacheHeader& Header)
+	{
+		return Ar << Header.Magic << Header.FormatVersion << Header.DecompositionVersion << Header.CollisionKey
+			<< Header.SourceHash << Header.PayloadSize << Header.PayloadHash;
+	}
+};
+
+static void CollectSectionsRecursive(const FModelNodeData& Node, TArray<const FModelMeshData*>& OutSections, TSet<const FModelMeshData*>& Seen)
+{
+	for (const TSharedPtr<FModelMeshData>& Section : Node.MeshSections)
+	{
+		bool bAlreadySeen = false;
+		Seen.Add(Section.Get(), &bAlreadySeen);
+		if (!bAlreadySeen)
+		{
+			OutSections.Add(Section.Get());
+		}
+	}
+	for (const FModelNodeData& Child : Node.Children)
+	{
+		CollectSectionsRecursive(Child, OutSections, Seen);
+	}
+}
+
+FString FModelCollisionCache::GetCollisionFilePath(const FString& SourceFilePath)
+{
+	return SourceFilePath + TEXT(".collision");
+}
+
+void FModelCollisionCache::CollectSections(const FModelNodeData& RootNode, TArray<const FModelMeshData*>& OutSections)
+{
+	TSet<const FModelMeshData*> Seen;
+	CollectSectionsRecursive(RootNode, OutSections, Seen);
+}
+
+bool FModelCollisionCache::Load(const FString& SourceFilePath, uint64 SourceHash, uint64 CollisionKey, TArrayView<const FModelMeshData* const> Sections, TMap<const FModelMeshData*, TArray<TArray<FVector>>>& OutHulls)
+{
+	const FString CollisionPath = GetCollisionFilePath(SourceFilePath);
+
+	// A few hulls per section: small enough to read whole
+	TArray64<uint8> Buffer;
+	if (!IFileManager::Get().FileExists(*CollisionPath) || !FFileHelper::LoadFileToArray(Buffer, *CollisionPath))
+	{
+		return false;
+	}
+
+	FMemoryReaderView Reader(TArrayView64<const uint8>(Buffer.GetData(), Buffer.Num()));
+	FCollisionCacheHeader Header;
+	Reader << Header;
+
+	const int64 PayloadOffset = Reader.Tell();
+	const bool bHeaderValid = !Reader.IsError()
+		&& Header.Magic == CollisionCacheMagic
+		&& Header.FormatVersion == FormatVersion
+		&& Header.DecompositionVersion == DecompositionVersion
+		&& Header.CollisionKey == CollisionKey
+		&& Header.SourceHash == SourceHash
+		&& Header.PayloadSize == Buffer.Num() - PayloadOffset;
+
+	if (!bHeaderValid || FXxHash64::HashBuffer(Buffer.GetData() + PayloadOffset, Header.PayloadSize).Hash != Header.PayloadHash)
+	{
+		UE_LOG(LogTemp, Log, TEXT("🔹 Collision file is stale, decomposing again: %s"), *CollisionPath);
+		return false;
+	}
+
+	int32 NumSections = 0;
+	Reader << NumSections;
+	if (NumSections != Sections.Num())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ Collision file was written for other sections: %s"), *CollisionPath);
+		return false;
+	}
+
+	TArray<TArray<TArray<FVector>>> Hulls;
+	Hulls.SetNum(NumSections);
+	for (int32 i = 0; i < NumSections && !Reader.IsError(); ++i)
+	{
+		int32 NumVertices = 0;
+		Reader << NumVertices;
+		if (NumVertices != Sections[i]->GetNumVertices())
+		{
+			Reader.SetError();
+			break;
+		}
+		Reader << Hulls[i];
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ Failed to read collision file: %s"), *CollisionPath);
+		return false;
+	}
+
+	for (int32 i = 0; i < NumSections; ++i)
+	{
+		OutHulls.Add(Sections[i], MoveTemp(Hulls[i]));
+	}
+	UE_LOG(LogTemp, Display, TEXT("✅ Loaded convex decomposition: %s"), *CollisionPath);
+	return true;
+}
+
+bool FModelCollisionCache::Save(const FString& SourceFilePath, uint64 SourceHash, uint64 CollisionKey, TArrayView<const FModelMeshData* const> Sections, const TMap<const FModelMeshData*, TArray<TArray<FVector>>>& Hulls)
+{
+	const FString CollisionPath = GetCollisionFilePath(SourceFilePath);
+
+	TArray64<uint8> Buffer;
+	FMemoryWriter64 Writer(Buffer);
+
+	// Header goes first with a blank payload hash, patched once the payload is written
+	FCollisionCacheHeader Header;
+	Header.CollisionKey = CollisionKey;
+	Header.SourceHash = SourceHash;
+	Writer << Header;
+	const int64 PayloadOffset = Writer.Tell();
+
+	static const TArray<TArray<FVector>> NoHulls;
+	int32 NumSections = Sections.Num();
+	Writer << NumSections;
+	for (const FModelMeshData* Section : Sections)
+	{
+		int32 NumVertices = Section->GetNumVertices();
+		Writer << NumVertices;
+		const TArray<TArray<FVector>>* SectionHulls = Hulls.Find(Section);
+		Writer << const_cast<TArray<TArray<FVector>>&>(SectionHulls ? *SectionHulls : NoHulls);
+	}
+
+	Header.PayloadSize = Buffer.Num() - PayloadOffset;
+	Header.PayloadHash = FXxHash64::HashBuffer(Buffer.GetData() + PayloadOffset, Header.PayloadSize).Hash;
+	Writer.Seek(0);
+	Writer << Header;
+
+	// Write to a temp file and rename so a crash or a concurrent reader never sees a half-written file
+	const FString TempPath = FString::Printf(TEXT("%s.%s.tmp"), *CollisionPath, *FGuid::NewGuid().ToString());
+	if (!FFileHelper::SaveArrayToFile(Buffer, *TempPath) || !IFileManager::Get().Move(*CollisionPath, *TempPath, true))
+	{
+		// The hulls are still used for this import; the next one decomposes again
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ Failed to write collision file (read-only model folder?): %s"), *CollisionPath);
+		IFileManager::Get().Delete(*TempPath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("✅ Wrote convex decomposition: %s (%lld bytes)"), *CollisionPath, Buffer.Num());
+	return true;
+}
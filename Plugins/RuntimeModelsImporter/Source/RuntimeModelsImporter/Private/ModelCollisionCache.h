@@ -0,0 +1,24 @@
+// Convex decompositions persisted next to the source file (<file>.collision), so each model is decomposed once rather than per import
+#pragma once
+#include "CoreMinimal.h"
+
+struct FModelNodeData;
+struct FModelMeshData;
+
+class FModelCollisionCache
+{
+public:
+    // Bump when the on-disk layout changes
+    static constexpr uint32 FormatVersion = 1;
+    // Bump when FModelConvexDecomposer produces different hulls for the same sections and settings
+    static constexpr uint32 DecompositionVersion = 1;
+
+    static FString GetCollisionFilePath(const FString& SourceFilePath);
+
+    // Unique sections of the node tree, depth first: the order the file stores them in
+    static void CollectSections(const FModelNodeData& RootNode, TArray<const FModelMeshData*>& OutSections);
+
+    // Fails (and leaves OutHulls untouched) on a missing, stale or corrupt file, or one written for other sections
+    static bool Load(const FString& SourceFilePath, uint64 SourceHash, uint64 CollisionKey, TArrayView<const FModelMeshData* const> Sections, TMap<const FModelMeshData*, TArray<TArray<FVector>>>& OutHulls);
+    static bool Save(const FString& SourceFilePath, uint64 SourceHash, uint64 CollisionKey, TArrayView<const FModelMeshData* const> Sections, const TMap<const FModelMeshData*, TArray<TArray<FVector>>>& Hulls);
+};
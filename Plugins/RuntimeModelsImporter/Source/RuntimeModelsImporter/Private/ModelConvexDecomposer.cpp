@@ -0,0 +1,350 @@
+// Approximate convex decomposition (V-HACD style): voxelize a section, then split its voxels with axis-aligned planes until every part is close to convex
+#include "ModelConvexDecomposer.h"
+#include "ModelCollisionBuilder.h"
+#include "ModelImportProfiler.h"
+#include "ModelMeshData.h"
+
+static constexpr uint8 VoxelEmpty = 0;
+static constexpr uint8 VoxelSurface = 1;
+static constexpr uint8 VoxelOutside = 2;
+
+// Voxels over the section's bounds plus a padding layer on every side, so the flood fill can start in a corner that is outside
+struct FModelVoxelGrid
+{
+	FVector Origin = FVector::ZeroVector;
+	double VoxelSize = 1.0;
+	FIntVector Dims = FIntVector::ZeroValue;
+
+	int32 Index(const FIntVector& Voxel) const { return (Voxel.Z * Dims.Y + Voxel.Y) * Dims.X + Voxel.X; }
+	bool IsInside(const FIntVector& Voxel) const
+	{
+		return Voxel.X >= 0 && Voxel.Y >= 0 && Voxel.Z >= 0 && Voxel.X < Dims.X && Voxel.Y < Dims.Y && Voxel.Z < Dims.Z;
+	}
+	FIntVector ToVoxel(const FVector& Point) const
+	{
+		return FIntVector(
+			FMath::Clamp(FMath::FloorToInt((Point.X - Origin.X) / VoxelSize), 0, Dims.X - 1),
+			FMath::Clamp(FMath::FloorToInt((Point.Y - Origin.Y) / VoxelSize), 0, Dims.Y - 1),
+			FMath::Clamp(FMath::FloorToInt((Point.Z - Origin.Z) / VoxelSize), 0, Dims.Z - 1));
+	}
+	FVector GetCorner(const FIntVector& Voxel) const { return Origin + FVector(Voxel) * VoxelSize; }
+};
+
+struct FModelVoxelPart
+{
+	TArray<FIntVector> Voxels;
+	FIntVector Min = FIntVector(MAX_int32);     // Inclusive voxel bounds
+	FIntVector Max = FIntVector(MIN_int32);
+	TArray<FVector> HullPoints;
+	int64 Concavity = 0;                        // Voxels inside the hull that do not belong to the part
+};
+
+static const FIntVector VoxelNeighbours[6] =
+{
+	FIntVector(-1, 0, 0), FIntVector(1, 0, 0), FIntVector(0, -1, 0), FIntVector(0, 1, 0), FIntVector(0, 0, -1), FIntVector(0, 0, 1)
+};
+
+static void GrowBounds(FIntVector& Min, FIntVector& Max, const FIntVector& Voxel)
+{
+	Min = FIntVector(FMath::Min(Min.X, Voxel.X), FMath::Min(Min.Y, Voxel.Y), FMath::Min(Min.Z, Voxel.Z));
+	Max = FIntVector(FMath::Max(Max.X, Voxel.X), FMath::Max(Max.Y, Voxel.Y), FMath::Max(Max.Z, Voxel.Z));
+}
+
+static int64 GetBoundsVolume(const FIntVector& Min, const FIntVector& Max)
+{
+	return Max.X < Min.X ? 0 : int64(Max.X - Min.X + 1) * (Max.Y - Min.Y + 1) * (Max.Z - Min.Z + 1);
+}
+
+static void BuildPartHull(const FModelVoxelGrid& Grid, const TArray<int32>& PartOf, int32 PartIndex, FModelVoxelPart& Part)
+{
+	Part.Min = FIntVector(MAX_int32);
+	Part.Max = FIntVector(MIN_int32);
+	for (const FIntVector& Voxel : Part.Voxels)
+	{
+		GrowBounds(Part.Min, Part.Max, Voxel);
+	}
+
+	// Only voxels on the part's boundary can be extreme, and their corners bound the part exactly
+	TArray<FIntVector> Boundary;
+	for (const FIntVector& Voxel : Part.Voxels)
+	{
+		for (const FIntVector& Offset : VoxelNeighbours)
+		{
+			const FIntVector Neighbour = Voxel + Offset;
+			if (!Grid.IsInside(Neighbour) || PartOf[Grid.Index(Neighbour)] != PartIndex)
+			{
+				Boundary.Add(Voxel);
+				break;
+			}
+		}
+	}
+	FModelCollisionBuilder::BuildConvexHullPoints(Boundary.Num() * 8, [&Grid, &Boundary](int32 Index)
+		{
+			const int32 Corner = Index % 8;
+			return Grid.GetCorner(Boundary[Index / 8] + FIntVector(Corner & 1, (Corner >> 1) & 1, (Corner >> 2) & 1));
+		}, Part.HullPoints);
+
+	// Concavity in voxels: cells of the part's bounds whose centre is behind every support plane of the hull, minus the part
+	const TArray<FVector>& Directions = FModelCollisionBuilder::GetHullDirections();
+	TArray<double, TInlineAllocator<64>> Support;
+	for (const FVector& Direction : Directions)
+	{
+		double Best = TNumericLimits<double>::Lowest();
+		for (const FVector& Point : Part.HullPoints)
+		{
+			Best = FMath::Max(Best, FVector::DotProduct(Point, Direction));
+		}
+		Support.Add(Best + Grid.VoxelSize * 0.01);
+	}
+
+	int64 Inside = 0;
+	for (int32 Z = Part.Min.Z; Z <= Part.Max.Z; ++Z)
+	{
+		for (int32 Y = Part.Min.Y; Y <= Part.Max.Y; ++Y)
+		{
+			for (int32 X = Part.Min.X; X <= Part.Max.X; ++X)
+			{
+				const FVector Center = Grid.GetCorner(FIntVector(X, Y, Z)) + FVector(Grid.VoxelSize * 0.5);
+				bool bInside = true;
+				for (int32 d = 0; d < Directions.Num() && bInside; ++d)
+				{
+					bInside = FVector::DotProduct(Center, Directions[d]) <= Support[d];
+				}
+				Inside += bInside ? 1 : 0;
+			}
+		}
+	}
+	Part.Concavity = FMath::Max<int64>(0, Inside - Part.Voxels.Num());
+}
+
+// Cuts Part with the axis-aligned plane that leaves the least empty space in the bounds of the two halves; every plane of an
+// axis is scored from one histogram of the part's voxel layers. Part keeps the low side, OutOther gets the rest
+static bool SplitPart(FModelVoxelPart& Part, FModelVoxelPart& OutOther)
+{
+	struct FLayer
+	{
+		int64 Count = 0;
+		FIntVector Min = FIntVector(MAX_int32);
+		FIntVector Max = FIntVector(MIN_int32);
+	};
+
+	int32 BestAxis = INDEX_NONE;
+	int32 BestCut = 0;
+	int64 BestCost = MAX_int64;
+	int64 BestImbalance = MAX_int64;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const int32 NumLayers = Part.Max[Axis] - Part.Min[Axis] + 1;
+		if (NumLayers < 2)
+		{
+			continue;
+		}
+
+		TArray<FLayer> Layers;
+		Layers.SetNum(NumLayers);
+		for (const FIntVector& Voxel : Part.Voxels)
+		{
+			FLayer& Layer = Layers[Voxel[Axis] - Part.Min[Axis]];
+			++Layer.Count;
+			GrowBounds(Layer.Min, Layer.Max, Voxel);
+		}
+
+		// Suffix bounds, then walk the cut from low to high with running prefix bounds
+		TArray<FLayer> Above;
+		Above.SetNum(NumLayers + 1);
+		for (int32 Layer = NumLayers - 1; Layer >= 0; --Layer)
+		{
+			Above[Layer] = Above[Layer + 1];
+			Above[Layer].Count += Layers[Layer].Count;
+			if (Layers[Layer].Count > 0)
+			{
+				GrowBounds(Above[Layer].Min, Above[Layer].Max, Layers[Layer].Min);
+				GrowBounds(Above[Layer].Min, Above[Layer].Max, Layers[Layer].Max);
+			}
+		}
+
+		FLayer Below;
+		for (int32 Cut = 1; Cut < NumLayers; ++Cut)
+		{
+			const FLayer& Layer = Layers[Cut - 1];
+			Below.Count += Layer.Count;
+			if (Layer.Count > 0)
+			{
+				GrowBounds(Below.Min, Below.Max, Layer.Min);
+				GrowBounds(Below.Min, Below.Max, Layer.Max);
+			}
+			if (Below.Count == 0 || Above[Cut].Count == 0)
+			{
+				continue;
+			}
+
+			const int64 Cost = GetBoundsVolume(Below.Min, Below.Max) - Below.Count + GetBoundsVolume(Above[Cut].Min, Above[Cut].Max) - Above[Cut].Count;
+			const int64 Imbalance = FMath::Abs(Below.Count - Above[Cut].Count);
+			if (Cost < BestCost || (Cost == BestCost && Imbalance < BestImbalance))
+			{
+				BestAxis = Axis;
+				BestCut = Part.Min[Axis] + Cut;
+				BestCost = Cost;
+				BestImbalance = Imbalance;
+			}
+		}
+	}
+
+	if (BestAxis == INDEX_NONE)
+	{
+		return false;
+	}
+
+	TArray<FIntVector> Low;
+	for (const FIntVector& Voxel : Part.Voxels)
+	{
+		(Voxel[BestAxis] < BestCut ? Low : OutOther.Voxels).Add(Voxel);
+	}
+	Part.Voxels = MoveTemp(Low);
+	return true;
+}
+
+void FModelConvexDecomposer::Decompose(const FModelMeshData& Section, const FParams& Params, TArray<TArray<FVector>>& OutHulls)
+{
+	const TArrayView<const int32> Indices = Section.GetIndices();
+	Decompose(Section.GetNumTriangles(), [&Section, Indices](int32 Triangle, FVector (&OutCorners)[3])
+		{
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				OutCorners[Corner] = FVector(Section.GetPosition(Indices[Triangle * 3 + Corner]));
+			}
+		}, Params, OutHulls);
+}
+
+void FModelConvexDecomposer::Decompose(int32 NumTriangles, TFunctionRef<void(int32, FVector (&)[3])> GetTriangle, const FParams& Params, TArray<TArray<FVector>>& OutHulls)
+{
+	MODEL_IMPORT_SCOPE(DecomposeCollision);
+
+	OutHulls.Reset();
+	FBox Bounds(ForceInit);
+	for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+	{
+		FVector Corners[3];
+		GetTriangle(Triangle, Corners);
+		Bounds += Corners[0];
+		Bounds += Corners[1];
+		Bounds += Corners[2];
+	}
+	const double Longest = Bounds.IsValid ? Bounds.GetSize().GetMax() : 0.0;
+	if (Longest <= UE_KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	// --- Voxel grid
+	const int32 Resolution = FMath::Clamp(Params.Resolution, MinResolution, MaxResolution);
+	FModelVoxelGrid Grid;
+	Grid.VoxelSize = Longest / Resolution;
+	Grid.Origin = Bounds.Min - FVector(Grid.VoxelSize);
+	const FVector Size = Bounds.GetSize();
+	Grid.Dims = FIntVector(
+		FMath::Min(FMath::FloorToInt(Size.X / Grid.VoxelSize), Resolution) + 3,
+		FMath::Min(FMath::FloorToInt(Size.Y / Grid.VoxelSize), Resolution) + 3,
+		FMath::Min(FMath::FloorToInt(Size.Z / Grid.VoxelSize), Resolution) + 3);
+	const int32 NumCells = Grid.Dims.X * Grid.Dims.Y * Grid.Dims.Z;
+
+	// --- Surface: every triangle sampled at half a voxel, so it leaves no gaps the flood fill could leak through
+	TArray<uint8> Cells;
+	Cells.SetNumZeroed(NumCells);
+	for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+	{
+		FVector Corners[3];
+		GetTriangle(Triangle, Corners);
+		const double MaxEdge = FMath::Max3(FVector::Dist(Corners[0], Corners[1]), FVector::Dist(Corners[1], Corners[2]), FVector::Dist(Corners[2], Corners[0]));
+		const int32 Steps = FMath::Clamp(FMath::CeilToInt(2.0 * MaxEdge / Grid.VoxelSize), 1, 4 * Resolution);
+		const FVector EdgeU = (Corners[1] - Corners[0]) / Steps;
+		const FVector EdgeV = (Corners[2] - Corners[0]) / Steps;
+		for (int32 u = 0; u <= Steps; ++u)
+		{
+			for (int32 v = 0; v <= Steps - u; ++v)
+			{
+				Cells[Grid.Index(Grid.ToVoxel(Corners[0] + EdgeU * u + EdgeV * v))] = VoxelSurface;
+			}
+		}
+	}
+
+	// --- Outside: flood fill from the padding corner; whatever it cannot reach is solid
+	TArray<int32> Stack;
+	Stack.Add(0);
+	Cells[0] = VoxelOutside;
+	while (Stack.Num() > 0)
+	{
+		const int32 Cell = Stack.Pop(EAllowShrinking::No);
+		const FIntVector Voxel(Cell % Grid.Dims.X, (Cell / Grid.Dims.X) % Grid.Dims.Y, Cell / (Grid.Dims.X * Grid.Dims.Y));
+		for (const FIntVector& Offset : VoxelNeighbours)
+		{
+			const FIntVector Neighbour = Voxel + Offset;
+			if (Grid.IsInside(Neighbour) && Cells[Grid.Index(Neighbour)] == VoxelEmpty)
+			{
+				Cells[Grid.Index(Neighbour)] = VoxelOutside;
+				Stack.Add(Grid.Index(Neighbour));
+			}
+		}
+	}
+
+	TArray<FModelVoxelPart> Parts;
+	TArray<int32> PartOf;
+	PartOf.Init(INDEX_NONE, NumCells);
+	FModelVoxelPart& Whole = Parts.AddDefaulted_GetRef();
+	for (int32 Z = 0; Z < Grid.Dims.Z; ++Z)
+	{
+		for (int32 Y = 0; Y < Grid.Dims.Y; ++Y)
+		{
+			for (int32 X = 0; X < Grid.Dims.X; ++X)
+			{
+				const FIntVector Voxel(X, Y, Z);
+				if (Cells[Grid.Index(Voxel)] != VoxelOutside)
+				{
+					Whole.Voxels.Add(Voxel);
+					PartOf[Grid.Index(Voxel)] = 0;
+				}
+			}
+		}
+	}
+	BuildPartHull(Grid, PartOf, 0, Parts[0]);
+
+	// --- Split the most concave part until all are within tolerance or the budget is spent
+	const int64 MaxConcavity = FMath::Max<int64>(1, FMath::RoundToInt64(Parts[0].Voxels.Num() * double(Params.MaxConcavity)));
+	while (Parts.Num() < FMath::Max(1, Params.MaxHulls))
+	{
+		int32 Worst = INDEX_NONE;
+		for (int32 PartIndex = 0; PartIndex < Parts.Num(); ++PartIndex)
+		{
+			const FModelVoxelPart& Part = Parts[PartIndex];
+			if (Part.Concavity > MaxConcavity && Part.Voxels.Num() > 1 && (Worst == INDEX_NONE || Part.Concavity > Parts[Worst].Concavity))
+			{
+				Worst = PartIndex;
+			}
+		}
+		if (Worst == INDEX_NONE)
+		{
+			break;
+		}
+
+		FModelVoxelPart Other;
+		if (!SplitPart(Parts[Worst], Other))
+		{
+			Parts[Worst].Concavity = 0;
+			continue;
+		}
+
+		const int32 OtherIndex = Parts.Add(MoveTemp(Other));
+		for (const FIntVector& Voxel : Parts[OtherIndex].Voxels)
+		{
+			PartOf[Grid.Index(Voxel)] = OtherIndex;
+		}
+		BuildPartHull(Grid, PartOf, Worst, Parts[Worst]);
+		BuildPartHull(Grid, PartOf, OtherIndex, Parts[OtherIndex]);
+	}
+
+	OutHulls.Reserve(Parts.Num());
+	for (FModelVoxelPart& Part : Parts)
+	{
+		OutHulls.Add(MoveTemp(Part.HullPoints));
+	}
+}
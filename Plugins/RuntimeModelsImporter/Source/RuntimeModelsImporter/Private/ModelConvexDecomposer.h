@@ -0,0 +1,24 @@
+// Approximate convex decomposition (V-HACD style): voxelize a section, then split its voxels with axis-aligned planes until every part is close to convex
+#pragma once
+#include "CoreMinimal.h"
+
+struct FModelMeshData;
+
+class FModelConvexDecomposer
+{
+public:
+    struct FParams
+    {
+        int32 MaxHulls = 16;
+        int32 Resolution = 32;          // Voxels along the longest axis, clamped to [MinResolution, MaxResolution]
+        float MaxConcavity = 0.02f;     // A part whose hull overshoots it by less than this fraction of the solid volume is not split
+    };
+
+    // Hull point sets (FModelCollisionBuilder::BuildConvexHullPoints of each part) in the section's space, the most concave part
+    // split first. Touches no UObjects. Open meshes have no inside, so their parts are shells and tend to use the whole budget
+    static void Decompose(const FModelMeshData& Section, const FParams& Params, TArray<TArray<FVector>>& OutHulls);
+    static void Decompose(int32 NumTriangles, TFunctionRef<void(int32 /*Triangle*/, FVector (&/*OutCorners*/)[3])> GetTriangle, const FParams& Params, TArray<TArray<FVector>>& OutHulls);
+
+    static constexpr int32 MinResolution = 4;
+    static constexpr int32 MaxResolution = 128;
+};
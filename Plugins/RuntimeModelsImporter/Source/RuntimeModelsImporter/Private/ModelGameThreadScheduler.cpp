@@ -0,0 +1,93 @@
+// GameThread work queue drained every frame under a millisecond budget, for the parts of a commit or spawn that must run there
+#include "ModelGameThreadScheduler.h"
+#include "ModelImportProfiler.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarModelImportGameThreadBudget(
+	TEXT("ModelImport.GameThreadBudgetMs"),
+	4.f,
+	TEXT("Milliseconds per frame the model importers may spend creating materials, textures and components on the GameThread"),
+	ECVF_Default);
+
+static TUniquePtr<FModelGameThreadScheduler> GModelGameThreadScheduler;
+
+FModelGameThreadScheduler& FModelGameThreadScheduler::Get()
+{
+	check(IsInGameThread() && GModelGameThreadScheduler.IsValid());
+	return *GModelGameThreadScheduler;
+}
+
+void FModelGameThreadScheduler::Startup()
+{
+	GModelGameThreadScheduler = MakeUnique<FModelGameThreadScheduler>();
+}
+
+void FModelGameThreadScheduler::Shutdown()
+{
+	GModelGameThreadScheduler.Reset();
+}
+
+void FModelGameThreadScheduler::Enqueue(EModelWorkPriority Priority, FWork&& Work)
+{
+	check(IsInGameThread());
+	Queues[static_cast<int32>(Priority)].Add(MoveTemp(Work));
+}
+
+int32 FModelGameThreadScheduler::GetNumPending() const
+{
+	int32 NumPending = 0;
+	for (int32 Queue = 0; Queue < UE_ARRAY_COUNT(Queues); ++Queue)
+	{
+		NumPending += Queues[Queue].Num() - Heads[Queue];
+	}
+	return NumPending;
+}
+
+void FModelGameThreadScheduler::RunSlice(double BudgetSeconds)
+{
+	MODEL_IMPORT_SCOPE(GameThreadSlice);
+
+	const double StartTime = FPlatformTime::Seconds();
+	bool bRanAny = false;
+	while (!bRanAny || FPlatformTime::Seconds() - StartTime < BudgetSeconds)
+	{
+		int32 Queue = 0;
+		while (Queue < UE_ARRAY_COUNT(Queues) && Heads[Queue] == Queues[Queue].Num())
+		{
+			++Queue;
+		}
+		if (Queue == UE_ARRAY_COUNT(Queues))
+		{
+			break;
+		}
+
+		// Work may enqueue more work, which can reallocate the queue, so the step runs on a moved-out copy
+		FWork Work = MoveTemp(Queues[Queue][Heads[Queue]]);
+		bRanAny = true;
+		if (!Work())
+		{
+			// Not finished: it keeps its place at the front of its queue
+			Queues[Queue][Heads[Queue]] = MoveTemp(Work);
+			continue;
+		}
+
+		if (++Heads[Queue] == Queues[Queue].Num())
+		{
+			Queues[Queue].Reset();
+			Heads[Queue] = 0;
+		}
+	}
+}
+
+void FModelGameThreadScheduler::Tick(float DeltaTime)
+{
+	if (GetNumPending() > 0)
+	{
+		RunSlice(CVarModelImportGameThreadBudget.GetValueOnGameThread() / 1000.0);
+	}
+}
+
+TStatId FModelGameThreadScheduler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(FModelGameThreadScheduler, STATGROUP_ModelImport);
+}
@@ -0,0 +1,36 @@
+// GameThread work queue drained every frame under a millisecond budget, for the parts of a commit or spawn that must run there
+#pragma once
+#include "CoreMinimal.h"
+#include "Tickable.h"
+#include "ModelImportSettings.h"
+
+class FModelGameThreadScheduler : public FTickableGameObject
+{
+public:
+    // Returns true once done; false to be called again in a later slice (work that splits itself into steps).
+    // Work never gets cancelled by the scheduler, it checks its own owner and returns true when there is nothing left to do
+    using FWork = TUniqueFunction<bool()>;
+
+    // Owned by the module, so it exists from StartupModule to ShutdownModule
+    static FModelGameThreadScheduler& Get();
+    static void Startup();
+    static void Shutdown();
+
+    void Enqueue(EModelWorkPriority Priority, FWork&& Work);
+    int32 GetNumPending() const;
+
+    // Runs queued work, highest priority first and in order within a priority, until BudgetSeconds are used up.
+    // At least one step runs per call, so a budget smaller than a single step still makes progress
+    void RunSlice(double BudgetSeconds);
+
+    // FTickableGameObject
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Always; }
+    virtual bool IsTickableWhenPaused() const override { return true; }
+    virtual bool IsTickableInEditor() const override { return true; }
+
+private:
+    TArray<FWork> Queues[3]; // Indexed by EModelWorkPriority
+    int32 Heads[3] = {};     // First live entry of each queue; compacted once a queue drains
+};
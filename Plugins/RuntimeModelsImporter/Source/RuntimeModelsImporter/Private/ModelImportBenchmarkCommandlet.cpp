@@ -0,0 +1,166 @@
+// Headless import benchmark: imports every model of a corpus folder through the runtime importer and writes throughput and stage times as JSON
+#include "ModelImportBenchmarkCommandlet.h"
+#include "AssimpBulkModelImporter.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+UModelImportBenchmarkCommandlet::UModelImportBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UModelImportBenchmarkCommandlet::Main(const FString& Params)
+{
+	// --- Arguments ---
+	FString CorpusPath;
+	if (!FParse::Value(*Params, TEXT("Corpus="), CorpusPath) || !FPaths::DirectoryExists(CorpusPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ ModelImportBenchmark needs -Corpus=<existing folder> (got '%s')"), *CorpusPath);
+		return 1;
+	}
+
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ModelImportBenchmark"), TEXT("Results.json"));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	FString CsvPath;
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+	int32 MaxInFlight = 0;
+	FParse::Value(*Params, TEXT("MaxInFlight="), MaxInFlight);
+	double TimeoutSeconds = 3600.0;
+	FParse::Value(*Params, TEXT("Timeout="), TimeoutSeconds);
+
+	FModelImportSettings Settings;
+	FString PresetName;
+	if (FParse::Value(*Params, TEXT("Preset="), PresetName))
+	{
+		EModelImportPreset Preset;
+		if (!FModelImportSettings::ParsePreset(PresetName, Preset))
+		{
+			UE_LOG(LogTemp, Error, TEXT("❌ Unknown import preset: %s"), *PresetName);
+			return 1;
+		}
+		Settings.ApplyPreset(Preset);
+	}
+	Settings.bUseModelCache = !FParse::Param(*Params, TEXT("NoCache"));
+	Settings.bCaptureAssimpProfile = FParse::Param(*Params, TEXT("AssimpProfile"));
+	Settings.bTimeSliceCommit = false; // No frames tick here, and the benchmark measures throughput rather than pacing
+
+	// --- Corpus (same formats ModelAsset scans for) ---
+	TArray<FString> Files;
+	const TArray<FString> Extensions = { TEXT("*.fbx"), TEXT("*.glb"), TEXT("*.obj"), TEXT("*.dae"), TEXT("*.3ds"), TEXT("*.stl") };
+	for (const FString& Ext : Extensions)
+	{
+		TArray<FString> TempFiles;
+		IFileManager::Get().FindFilesRecursive(TempFiles, *CorpusPath, *Ext, true, false);
+		Files.Append(TempFiles);
+	}
+	Files.Sort();
+
+	if (Files.Num() == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ No model files found in corpus: %s"), *CorpusPath);
+		return 1;
+	}
+
+	// --- Import ---
+	UAssimpBulkModelImporter* BulkImporter = NewObject<UAssimpBulkModelImporter>();
+	BulkImporter->AddToRoot(); // No GC runs in here, but keep the importers alive regardless
+
+	const double StartTime = FPlatformTime::Seconds();
+	BulkImporter->ImportModels(Files, MaxInFlight, Settings);
+
+	// Commits are queued to the GameThread and a commandlet has no engine loop, so pump it until every model reported
+	bool bTimedOut = false;
+	while (!BulkImporter->IsFinished())
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
+		{
+			UE_LOG(LogTemp, Error, TEXT("❌ ModelImportBenchmark timed out after %.0f s"), TimeoutSeconds);
+			BulkImporter->CancelAll();
+			bTimedOut = true;
+			break;
+		}
+		FPlatformProcess::Sleep(0.001f);
+	}
+
+	const double WallSeconds = FPlatformTime::Seconds() - StartTime;
+	const TArray<FModelImportTimings> Timings = BulkImporter->GetImportTimings();
+	BulkImporter->RemoveFromRoot();
+
+	// --- Results ---
+	int32 NumSucceeded = 0;
+	int64 TotalBytes = 0;
+	int64 TotalTriangles = 0;
+	FModelImportTimings StageTotals; // Summed over imports, Calls is the number of imports that ran the stage
+	for (const FModelImportTimings& Import : Timings)
+	{
+		NumSucceeded += Import.bSuccess ? 1 : 0;
+		TotalBytes += Import.SourceBytes;
+		TotalTriangles += Import.NumTriangles;
+		for (const FModelImportStageTiming& Stage : Import.Stages)
+		{
+			StageTotals.AddStage(Stage.Name, Stage.Seconds);
+		}
+	}
+
+	const double SafeWallSeconds = FMath::Max(WallSeconds, UE_DOUBLE_SMALL_NUMBER);
+	const double PeakResidentMB = FPlatformMemory::GetStats().PeakUsedPhysical / (1024.0 * 1024.0);
+
+	TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+	Results->SetStringField(TEXT("Corpus"), CorpusPath);
+	Results->SetStringField(TEXT("Preset"), StaticEnum<EModelImportPreset>()->GetNameStringByValue(static_cast<int64>(Settings.Preset)));
+	Results->SetBoolField(TEXT("UseModelCache"), Settings.bUseModelCache);
+	Results->SetNumberField(TEXT("MaxInFlight"), MaxInFlight);
+	Results->SetNumberField(TEXT("Files"), Files.Num());
+	Results->SetNumberField(TEXT("Succeeded"), NumSucceeded);
+	Results->SetBoolField(TEXT("TimedOut"), bTimedOut);
+	Results->SetNumberField(TEXT("WallSeconds"), WallSeconds);
+	Results->SetNumberField(TEXT("FilesPerSecond"), Timings.Num() / SafeWallSeconds);
+	Results->SetNumberField(TEXT("MegabytesPerSecond"), TotalBytes / (1024.0 * 1024.0) / SafeWallSeconds);
+	Results->SetNumberField(TEXT("TrianglesPerSecond"), TotalTriangles / SafeWallSeconds);
+	Results->SetNumberField(TEXT("PeakResidentMegabytes"), PeakResidentMB);
+
+	TSharedRef<FJsonObject> StageSeconds = MakeShared<FJsonObject>();
+	for (const FModelImportStageTiming& Stage : StageTotals.Stages)
+	{
+		StageSeconds->SetNumberField(Stage.Name, Stage.Seconds);
+	}
+	Results->SetObjectField(TEXT("StageSeconds"), StageSeconds);
+
+	TArray<TSharedPtr<FJsonValue>> Imports;
+	for (const FModelImportTimings& Import : Timings)
+	{
+		Imports.Add(MakeShared<FJsonValueObject>(Import.ToJsonObject()));
+	}
+	Results->SetArrayField(TEXT("Imports"), Imports);
+
+	FString Output;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Results, Writer);
+
+	if (!FFileHelper::SaveStringToFile(Output, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Failed to write benchmark results: %s"), *OutputPath);
+		return 1;
+	}
+	if (!CsvPath.IsEmpty())
+	{
+		FModelImportTimings::SaveToFile(Timings, CsvPath);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("✅ ModelImportBenchmark: %d/%d models in %.2f s | %.2f files/s | %.2f MB/s | %.0f tris/s | peak RSS %.0f MB -> %s"),
+		NumSucceeded, Files.Num(), WallSeconds, Timings.Num() / SafeWallSeconds, TotalBytes / (1024.0 * 1024.0) / SafeWallSeconds,
+		TotalTriangles / SafeWallSeconds, PeakResidentMB, *OutputPath);
+
+	return (bTimedOut || NumSucceeded != Files.Num()) ? 1 : 0;
+}
@@ -0,0 +1,346 @@
+// Versioned on-disk cache of extracted model data (node tree, mesh streams, material descriptors) so warm loads skip Assimp
+#include "ModelImportCache.h"
+#include "AssimpRuntime3DModelsImporter.h"
+#include "AssimpMappedIOSystem.h"
+#include "Hash/xxhash.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "assimp/version.h"
+
+// File layout: fixed header, then one payload blob checked by PayloadHash.
+// The payload holds a table of unique meshes, then the node tree referencing them by table index, then materials.
+// Each mesh's stream block is written raw, so loading is one memcpy per mesh out of the mapped file.
+static constexpr uint32 ModelCacheMagic = 0x434D4D41; // 'AMMC'
+
+// A different Assimp build can read the same file differently, so entries are only valid for the library that wrote them
+static uint64 GetAssimpVersion()
+{
+	const uint32 VersionParts[] = { aiGetVersionMajor(), aiGetVersionMinor(), aiGetVersionPatch(), aiGetVersionRevision() };
+	return FXxHash64::HashBuffer(VersionParts, sizeof(VersionParts)).Hash;
+}
+
+struct FModelCacheHeader
+{
+	uint32 Magic = ModelCacheMagic;
+	uint32 FormatVersion = FModelImportCache::FormatVersion;
+	uint32 ExtractionVersion = FModelImportCache::ExtractionVersion;
+	uint64 AssimpVersion = GetAssimpVersion();
+	uint64 SettingsKey = 0;
+	uint64 SourceHash = 0;
+	int64 PayloadSize = 0;
+	uint64 PayloadHash = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FModelCacheHeader& Header)
+	{
+		return Ar << Header.Magic << Header.FormatVersion << Header.ExtractionVersion << Header.AssimpVersion << Header.SettingsKey
+			<< Header.SourceHash << Header.PayloadSize << Header.PayloadHash;
+	}
+};
+
+static void SerializeMesh(FArchive& Ar, FModelMeshData& Mesh)
+{
+	Mesh.SerializeStreams(Ar);
+	Ar << Mesh.MaterialName;
+	Ar << Mesh.MaterialIndex;
+	Ar << Mesh.LODIndices;
+}
+
+// Shared meshes are written once; MeshIndices maps each one to its slot in the mesh table
+static void CollectMeshes(const FModelNodeData& Node, TArray<TSharedPtr<FModelMeshData>>& OutMeshes, TMap<const FModelMeshData*, int32>& OutMeshIndices)
+{
+	for (const TSharedPtr<FModelMeshData>& Section : Node.MeshSections)
+	{
+		if (!OutMeshIndices.Contains(Section.Get()))
+		{
+			OutMeshIndices.Add(Section.Get(), OutMeshes.Add(Section));
+		}
+	}
+	for (const FModelNodeData& Child : Node.Children)
+	{
+		CollectMeshes(Child, OutMeshes, OutMeshIndices);
+	}
+}
+
+static void SerializeNode(FArchive& Ar, FModelNodeData& Node, const TArray<TSharedPtr<FModelMeshData>>& Meshes, const TMap<const FModelMeshData*, int32>& MeshIndices)
+{
+	Ar << Node.Name;
+	Ar << Node.Transform;
+
+	int32 NumSections = Node.MeshSections.Num();
+	Ar << NumSections;
+	if (Ar.IsLoading())
+	{
+		if (NumSections < 0) { Ar.SetError(); return; }
+		Node.MeshSections.SetNum(NumSections);
+	}
+	for (TSharedPtr<FModelMeshData>& Section : Node.MeshSections)
+	{
+		int32 MeshIndex = Ar.IsLoading() ? INDEX_NONE : MeshIndices.FindChecked(Section.Get());
+		Ar << MeshIndex;
+		if (Ar.IsLoading())
+		{
+			if (!Meshes.IsValidIndex(MeshIndex)) { Ar.SetError(); return; }
+			Section = Meshes[MeshIndex];
+		}
+	}
+
+	int32 NumChildren = Node.Children.Num();
+	Ar << NumChildren;
+	if (Ar.IsLoading())
+	{
+		if (NumChildren < 0) { Ar.SetError(); return; }
+		Node.Children.SetNum(NumChildren);
+	}
+	for (FModelNodeData& Child : Node.Children)
+	{
+		if (Ar.IsError()) return;
+		SerializeNode(Ar, Child, Meshes, MeshIndices);
+	}
+}
+
+// Texture files are stored relative to ModelDir, so an entry stays valid when the model folder moves or is copied with its textures
+static void SerializeMaterial(FArchive& Ar, FModelMaterialData& Material, const FString& ModelDir)
+{
+	Ar << Material.Name;
+	Ar << Material.bHasBaseColor;
+	Ar << Material.BaseColor;
+
+	int32 NumTextures = Material.Textures.Num();
+	Ar << NumTextures;
+	if (Ar.IsLoading())
+	{
+		if (NumTextures < 0) { Ar.SetError(); return; }
+		Material.Textures.SetNum(NumTextures);
+	}
+	for (FModelTextureSlot& Slot : Material.Textures)
+	{
+		FString ParamName = Slot.ParamName.ToString();
+		Ar << ParamName;
+		Slot.ParamName = FName(*ParamName);
+		Ar << Slot.TextureType;
+		Ar << Slot.bIsColor;
+		Ar << Slot.SourcePath;
+		FString ResolvedPath = Slot.ResolvedPath;
+		if (Ar.IsSaving() && !ResolvedPath.IsEmpty())
+		{
+			FString RelativePath = ResolvedPath;
+			if (FPaths::MakePathRelativeTo(RelativePath, *ModelDir))
+			{
+				ResolvedPath = RelativePath;
+			}
+		}
+		Ar << ResolvedPath;
+		if (Ar.IsLoading())
+		{
+			Slot.ResolvedPath = ResolvedPath.IsEmpty() || !FPaths::IsRelative(ResolvedPath) ? ResolvedPath : FPaths::ConvertRelativePathToFull(ModelDir, ResolvedPath);
+		}
+		Slot.EmbeddedData.BulkSerialize(Ar);
+		Ar << Slot.EmbeddedWidth;
+		Ar << Slot.EmbeddedHeight;
+	}
+}
+
+uint64 FModelImportCache::HashSourceFile(const uint8* Data, int64 Size)
+{
+	return FXxHash64::HashBuffer(Data, Size).Hash;
+}
+
+static FString GetModelDir(const FString& SourceFilePath)
+{
+	return FPaths::GetPath(FPaths::ConvertRelativePathToFull(SourceFilePath)) + TEXT("/");
+}
+
+FString FModelImportCache::GetCacheFilePath(const FString& SourceFilePath, uint64 SourceHash, uint64 SettingsKey)
+{
+	// Any change to the key inputs lands on a different file, so stale entries are simply never looked up again
+	const uint64 KeyParts[] = { SourceHash, SettingsKey, FormatVersion, ExtractionVersion, GetAssimpVersion() };
+	const uint64 Key = FXxHash64::HashBuffer(KeyParts, sizeof(KeyParts)).Hash;
+
+	// The full path tells apart models that share a file name in different folders, which would otherwise evict each other
+	FString FullPath = FPaths::ConvertRelativePathToFull(SourceFilePath);
+	FPaths::NormalizeFilename(FullPath);
+	FullPath.ToLowerInline();
+	const uint32 PathHash = static_cast<uint32>(FXxHash64::HashBuffer(*FullPath, FullPath.Len() * sizeof(TCHAR)).Hash);
+
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ModelCache"),
+		FString::Printf(TEXT("%s_%08x_%016llx.amc"), *FPaths::GetBaseFilename(SourceFilePath), PathHash, Key));
+}
+
+// Entries of the same source path written for an older version of the file, the cache or Assimp can never be looked up
+// again; they are deleted once a fresh one is written. Entries for other settings of the current file are still valid and kept
+static void PruneStaleEntries(const FString& CachePath, uint64 SourceHash)
+{
+	// <BaseName>_<PathHash>_<Key>.amc: everything before the 16 hex digits of the key names the source path
+	const FString CacheDir = FPaths::GetPath(CachePath);
+	const FString CacheFileName = FPaths::GetCleanFilename(CachePath);
+	const FString PathPrefix = CacheFileName.LeftChop(16 + 4);
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(CacheDir, PathPrefix + TEXT("*.amc")), true, false);
+	for (const FString& FileName : FileNames)
+	{
+		if (FileName == CacheFileName)
+		{
+			continue;
+		}
+
+		// Only the header is read; the reader is closed again before the delete
+		const FString EntryPath = FPaths::Combine(CacheDir, FileName);
+		if (TUniquePtr<FArchive> Reader{ IFileManager::Get().CreateFileReader(*EntryPath) })
+		{
+			FModelCacheHeader Header;
+			*Reader << Header;
+			const bool bCurrent = !Reader->IsError()
+				&& Header.Magic == ModelCacheMagic
+				&& Header.FormatVersion == FModelImportCache::FormatVersion
+				&& Header.ExtractionVersion == FModelImportCache::ExtractionVersion
+				&& Header.AssimpVersion == GetAssimpVersion()
+				&& Header.SourceHash == SourceHash;
+			if (bCurrent)
+			{
+				continue;
+			}
+		}
+
+		// May fail while another import has the entry mapped; the next Save retries
+		if (IFileManager::Get().Delete(*EntryPath, false, false, true))
+		{
+			UE_LOG(LogTemp, Log, TEXT("🔹 Deleted stale model cache: %s"), *EntryPath);
+		}
+	}
+}
+
+bool FModelImportCache::Load(const FString& SourceFilePath, uint64 SourceHash, uint64 SettingsKey, FModelNodeData& OutRootNode, TArray<FModelMaterialData>& OutMaterials)
+{
+	const FString CachePath = GetCacheFilePath(SourceFilePath, SourceHash, SettingsKey);
+	const FString ModelDir = GetModelDir(SourceFilePath);
+
+	TSharedPtr<FAssimpMappedFile> File = FAssimpMappedFile::Open(CachePath);
+	if (!File.IsValid())
+	{
+		return false;
+	}
+
+	FMemoryReaderView Reader(TArrayView64<const uint8>(File->GetData(), File->GetSize()));
+
+	FModelCacheHeader Header;
+	Reader << Header;
+
+	const int64 PayloadOffset = Reader.Tell();
+	const bool bHeaderValid = !Reader.IsError()
+		&& Header.Magic == ModelCacheMagic
+		&& Header.FormatVersion == FormatVersion
+		&& Header.ExtractionVersion == ExtractionVersion
+		&& Header.AssimpVersion == GetAssimpVersion()
+		&& Header.SettingsKey == SettingsKey
+		&& Header.SourceHash == SourceHash
+		&& Header.PayloadSize == File->GetSize() - PayloadOffset;
+
+	if (!bHeaderValid || HashSourceFile(File->GetData() + PayloadOffset, Header.PayloadSize) != Header.PayloadHash)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ Ignoring stale or corrupt model cache: %s"), *CachePath);
+		return false;
+	}
+
+	int32 NumMeshes = 0;
+	Reader << NumMeshes;
+	TArray<TSharedPtr<FModelMeshData>> Meshes;
+	if (NumMeshes >= 0 && !Reader.IsError())
+	{
+		Meshes.Reserve(NumMeshes);
+		for (int32 i = 0; i < NumMeshes && !Reader.IsError(); ++i)
+		{
+			TSharedPtr<FModelMeshData> Mesh = MakeShared<FModelMeshData>();
+			SerializeMesh(Reader, *Mesh);
+			Meshes.Add(MoveTemp(Mesh));
+		}
+	}
+	else
+	{
+		Reader.SetError();
+	}
+
+	if (!Reader.IsError())
+	{
+		SerializeNode(Reader, OutRootNode, Meshes, TMap<const FModelMeshData*, int32>());
+	}
+
+	int32 NumMaterials = 0;
+	Reader << NumMaterials;
+	if (NumMaterials >= 0 && !Reader.IsError())
+	{
+		OutMaterials.SetNum(NumMaterials);
+		for (FModelMaterialData& Material : OutMaterials)
+		{
+			SerializeMaterial(Reader, Material, ModelDir);
+		}
+	}
+
+	if (Reader.IsError() || NumMaterials < 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ Failed to read model cache: %s"), *CachePath);
+		OutRootNode = FModelNodeData();
+		OutMaterials.Empty();
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("✅ Loaded model from cache: %s"), *CachePath);
+	return true;
+}
+
+bool FModelImportCache::Save(const FString& SourceFilePath, uint64 SourceHash, uint64 SettingsKey, const FModelNodeData& RootNode, const TArray<FModelMaterialData>& Materials)
+{
+	const FString CachePath = GetCacheFilePath(SourceFilePath, SourceHash, SettingsKey);
+	const FString ModelDir = GetModelDir(SourceFilePath);
+
+	TArray64<uint8> Buffer;
+	FMemoryWriter64 Writer(Buffer);
+
+	// Header goes first with a blank payload hash, patched once the payload is written
+	FModelCacheHeader Header;
+	Header.SettingsKey = SettingsKey;
+	Header.SourceHash = SourceHash;
+	Writer << Header;
+	const int64 PayloadOffset = Writer.Tell();
+
+	TArray<TSharedPtr<FModelMeshData>> Meshes;
+	TMap<const FModelMeshData*, int32> MeshIndices;
+	CollectMeshes(RootNode, Meshes, MeshIndices);
+
+	int32 NumMeshes = Meshes.Num();
+	Writer << NumMeshes;
+	for (const TSharedPtr<FModelMeshData>& Mesh : Meshes)
+	{
+		SerializeMesh(Writer, *Mesh);
+	}
+
+	SerializeNode(Writer, const_cast<FModelNodeData&>(RootNode), Meshes, MeshIndices);
+	int32 NumMaterials = Materials.Num();
+	Writer << NumMaterials;
+	for (const FModelMaterialData& Material : Materials)
+	{
+		SerializeMaterial(Writer, const_cast<FModelMaterialData&>(Material), ModelDir);
+	}
+
+	Header.PayloadSize = Buffer.Num() - PayloadOffset;
+	Header.PayloadHash = HashSourceFile(Buffer.GetData() + PayloadOffset, Header.PayloadSize);
+	Writer.Seek(0);
+	Writer << Header;
+
+	// Write to a temp file and rename so a crash or a concurrent reader never sees a half-written entry
+	const FString TempPath = FString::Printf(TEXT("%s.%s.tmp"), *CachePath, *FGuid::NewGuid().ToString());
+	if (!FFileHelper::SaveArrayToFile(Buffer, *TempPath) || !IFileManager::Get().Move(*CachePath, *TempPath, true))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ Failed to write model cache: %s"), *CachePath);
+		IFileManager::Get().Delete(*TempPath);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("✅ Wrote model cache: %s (%lld bytes)"), *CachePath, Buffer.Num());
+	PruneStaleEntries(CachePath, SourceHash);
+	return true;
+}
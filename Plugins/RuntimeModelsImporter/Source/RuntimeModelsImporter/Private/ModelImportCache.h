@@ -0,0 +1,23 @@
+// Versioned on-disk cache of extracted model data (node tree, mesh streams, material descriptors) so warm loads skip Assimp
+#pragma once
+#include "CoreMinimal.h"
+
+struct FModelNodeData;
+struct FModelMaterialData;
+
+class FModelImportCache
+{
+public:
+    // Bump when the on-disk layout changes
+    static constexpr uint32 FormatVersion = 8;
+    // Bump when ParseNode/ExtractMesh/ExtractMaterial produce different data for the same source file and settings
+    static constexpr uint32 ExtractionVersion = 9;
+
+    static uint64 HashSourceFile(const uint8* Data, int64 Size);
+    static FString GetCacheFilePath(const FString& SourceFilePath, uint64 SourceHash, uint64 SettingsKey);
+
+    // Fails (and leaves the outputs empty) on a missing, stale or corrupt entry, the caller then does a full import
+    static bool Load(const FString& SourceFilePath, uint64 SourceHash, uint64 SettingsKey, FModelNodeData& OutRootNode, TArray<FModelMaterialData>& OutMaterials);
+    // Also deletes the entries of the same source path that went stale (older file contents, cache version or Assimp build)
+    static bool Save(const FString& SourceFilePath, uint64 SourceHash, uint64 SettingsKey, const FModelNodeData& RootNode, const TArray<FModelMaterialData>& Materials);
+};
@@ -0,0 +1,178 @@
+// Importer instrumentation: Insights trace channel, stat group and the per-import timing collector behind MODEL_IMPORT_SCOPE
+#include "ModelImportProfiler.h"
+#include "assimp/Importer.hpp"
+#include "assimp/config.h"
+#include "assimp/DefaultLogger.hpp"
+#include "assimp/LogStream.hpp"
+#include "Misc/ScopeLock.h"
+
+UE_TRACE_CHANNEL_DEFINE(ModelImportChannel);
+
+DEFINE_STAT(STAT_ModelImport_SourceRead);
+DEFINE_STAT(STAT_ModelImport_LoadCache);
+DEFINE_STAT(STAT_ModelImport_ReadFile);
+DEFINE_STAT(STAT_ModelImport_ParseNode);
+DEFINE_STAT(STAT_ModelImport_ExtractMesh);
+DEFINE_STAT(STAT_ModelImport_WeldVertices);
+DEFINE_STAT(STAT_ModelImport_GenerateNormals);
+DEFINE_STAT(STAT_ModelImport_CreateTexture);
+DEFINE_STAT(STAT_ModelImport_GameThreadSlice);
+DEFINE_STAT(STAT_ModelImport_ChunkMesh);
+DEFINE_STAT(STAT_ModelImport_OptimizeMesh);
+DEFINE_STAT(STAT_ModelImport_SimplifyMesh);
+DEFINE_STAT(STAT_ModelImport_ExtractTangents);
+DEFINE_STAT(STAT_ModelImport_ExtractMaterial);
+DEFINE_STAT(STAT_ModelImport_SaveCache);
+DEFINE_STAT(STAT_ModelImport_Commit);
+DEFINE_STAT(STAT_ModelImport_CreateMaterial);
+DEFINE_STAT(STAT_ModelImport_TextureDecode);
+DEFINE_STAT(STAT_ModelImport_SpawnInstances);
+DEFINE_STAT(STAT_ModelImport_SpawnNodeRecursive);
+DEFINE_STAT(STAT_ModelImport_BuildMeshDescription);
+DEFINE_STAT(STAT_ModelImport_BuildStaticMesh);
+DEFINE_STAT(STAT_ModelImport_BuildCollisionHull);
+DEFINE_STAT(STAT_ModelImport_CookCollision);
+DEFINE_STAT(STAT_ModelImport_DecomposeCollision);
+
+static thread_local FModelImportProfiler* GCurrentModelImportProfiler = nullptr;
+
+// Assimp's logger is process-wide, but every message is written on the thread that runs the import,
+// so the thread's current profiler is the import the message belongs to
+class FAssimpProfilerLogStream : public Assimp::LogStream
+{
+public:
+	virtual void write(const char* Message) override
+	{
+		if (FModelImportProfiler* Profiler = FModelImportProfiler::GetCurrent())
+		{
+			Profiler->HandleAssimpLog(Message);
+		}
+	}
+};
+
+static FCriticalSection GAssimpLoggerLock;
+static bool bAssimpLoggerAttached = false;
+static bool bCreatedAssimpLogger = false;
+
+FModelImportProfiler::FModelImportProfiler(const FString& FilePath)
+{
+	Timings.FilePath = FilePath;
+}
+
+void FModelImportProfiler::AddStage(const TCHAR* Name, double Seconds)
+{
+	FScopeLock ScopeLock(&Lock);
+	Timings.AddStage(Name, Seconds);
+}
+
+FModelImportTimings FModelImportProfiler::GetTimings() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Timings;
+}
+
+void FModelImportProfiler::Update(TFunctionRef<void(FModelImportTimings&)> Func)
+{
+	FScopeLock ScopeLock(&Lock);
+	Func(Timings);
+}
+
+FModelImportProfiler* FModelImportProfiler::GetCurrent()
+{
+	return GCurrentModelImportProfiler;
+}
+
+FModelImportProfiler::FScopedContext::FScopedContext(FModelImportProfiler* Profiler)
+	: Previous(GCurrentModelImportProfiler)
+{
+	GCurrentModelImportProfiler = Profiler;
+}
+
+FModelImportProfiler::FScopedContext::~FScopedContext()
+{
+	GCurrentModelImportProfiler = Previous;
+}
+
+void FModelImportProfiler::ConfigureAssimpProfiling(Assimp::Importer& Importer, bool bEnable)
+{
+	// Set both ways: pooled importers keep their properties from the previous import
+	Importer.SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, bEnable);
+	if (!bEnable)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&GAssimpLoggerLock);
+	if (bAssimpLoggerAttached)
+	{
+		return;
+	}
+
+	// Profiler regions are logged at debug severity. Once attached the capture stays on for the session,
+	// which costs every later import the formatting of Assimp's debug messages
+	if (Assimp::DefaultLogger::isNullLogger())
+	{
+		Assimp::DefaultLogger::create("", Assimp::Logger::DEBUGGING, 0);
+		bCreatedAssimpLogger = true;
+	}
+	Assimp::DefaultLogger::get()->setLogSeverity(Assimp::Logger::DEBUGGING);
+	Assimp::DefaultLogger::get()->attachStream(new FAssimpProfilerLogStream(), Assimp::Logger::Debugging); // Logger takes ownership
+	bAssimpLoggerAttached = true;
+}
+
+void FModelImportProfiler::Shutdown()
+{
+	FScopeLock ScopeLock(&GAssimpLoggerLock);
+	if (bCreatedAssimpLogger)
+	{
+		Assimp::DefaultLogger::kill(); // Deletes the attached streams as well
+	}
+	bCreatedAssimpLogger = false;
+	bAssimpLoggerAttached = false;
+}
+
+void FModelImportProfiler::HandleAssimpLog(const char* Message)
+{
+	// Messages look like "Debug, T1234: <text>\n"
+	FString Line = UTF8_TO_TCHAR(Message);
+	Line.TrimEndInline();
+	const int32 TextStart = Line.Find(TEXT(": "));
+	const FString Text = TextStart != INDEX_NONE ? Line.RightChop(TextStart + 2) : Line;
+
+	// Most postprocess steps announce themselves, which names the anonymous "postprocess" region that follows
+	if (Text.EndsWith(TEXT("Process begin")))
+	{
+		FScopeLock ScopeLock(&Lock);
+		CurrentPostProcessStep = Text.LeftChop(6); // Drop " begin"
+		return;
+	}
+
+	// Profiler::EndRegion: "END   `<region>`, dt= <seconds> s"
+	if (!Text.StartsWith(TEXT("END   `")))
+	{
+		return;
+	}
+
+	const int32 RegionStart = 7;
+	const int32 RegionEnd = Text.Find(TEXT("`"), ESearchCase::CaseSensitive, ESearchDir::FromStart, RegionStart);
+	const int32 SecondsStart = Text.Find(TEXT("dt= "));
+	if (RegionEnd == INDEX_NONE || SecondsStart == INDEX_NONE)
+	{
+		return;
+	}
+
+	const FString Region = Text.Mid(RegionStart, RegionEnd - RegionStart);
+	const double Seconds = FCString::Atod(*Text.Mid(SecondsStart + 4));
+
+	FScopeLock ScopeLock(&Lock);
+	Timings.AssimpProfilerLines.Add(Text);
+	if (Region == TEXT("postprocess") && !CurrentPostProcessStep.IsEmpty())
+	{
+		Timings.AddStage(FString::Printf(TEXT("Assimp.%s"), *CurrentPostProcessStep), Seconds);
+		CurrentPostProcessStep.Reset();
+	}
+	else
+	{
+		Timings.AddStage(FString::Printf(TEXT("Assimp.%s"), *Region), Seconds);
+	}
+}
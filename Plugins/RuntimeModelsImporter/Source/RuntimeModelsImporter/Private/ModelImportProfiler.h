@@ -0,0 +1,99 @@
+// Importer instrumentation: Insights trace channel, stat group and the per-import timing collector behind MODEL_IMPORT_SCOPE
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ModelImportTimings.h"
+
+namespace Assimp { class Importer; }
+
+// Enable with -trace=cpu,ModelImport (or "Trace.Enable ModelImport") to see the importer stages in Unreal Insights
+UE_TRACE_CHANNEL_EXTERN(ModelImportChannel);
+
+// "stat ModelImport"
+DECLARE_STATS_GROUP(TEXT("ModelImport"), STATGROUP_ModelImport, STATCAT_Advanced);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SourceRead"), STAT_ModelImport_SourceRead, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LoadCache"), STAT_ModelImport_LoadCache, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ReadFile"), STAT_ModelImport_ReadFile, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ParseNode"), STAT_ModelImport_ParseNode, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ExtractMesh"), STAT_ModelImport_ExtractMesh, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("WeldVertices"), STAT_ModelImport_WeldVertices, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GenerateNormals"), STAT_ModelImport_GenerateNormals, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CreateTexture"), STAT_ModelImport_CreateTexture, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GameThreadSlice"), STAT_ModelImport_GameThreadSlice, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ChunkMesh"), STAT_ModelImport_ChunkMesh, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OptimizeMesh"), STAT_ModelImport_OptimizeMesh, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SimplifyMesh"), STAT_ModelImport_SimplifyMesh, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ExtractTangents"), STAT_ModelImport_ExtractTangents, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ExtractMaterial"), STAT_ModelImport_ExtractMaterial, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SaveCache"), STAT_ModelImport_SaveCache, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Commit"), STAT_ModelImport_Commit, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CreateMaterial"), STAT_ModelImport_CreateMaterial, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("TextureDecode"), STAT_ModelImport_TextureDecode, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SpawnInstances"), STAT_ModelImport_SpawnInstances, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SpawnNodeRecursive"), STAT_ModelImport_SpawnNodeRecursive, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("BuildMeshDescription"), STAT_ModelImport_BuildMeshDescription, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("BuildStaticMesh"), STAT_ModelImport_BuildStaticMesh, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("BuildCollisionHull"), STAT_ModelImport_BuildCollisionHull, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CookCollision"), STAT_ModelImport_CookCollision, STATGROUP_ModelImport, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("DecomposeCollision"), STAT_ModelImport_DecomposeCollision, STATGROUP_ModelImport, );
+
+// Collects the timing record of one import. Stages find it through a per-thread context instead of a parameter,
+// so static helpers like ExtractMesh and Assimp's own log output can be attributed without threading it through
+class FModelImportProfiler
+{
+public:
+    explicit FModelImportProfiler(const FString& FilePath);
+
+    void AddStage(const TCHAR* Name, double Seconds);
+    // Locked copy of the record, safe while workers are still adding to it
+    FModelImportTimings GetTimings() const;
+    // Applies a change to the record under the lock
+    void Update(TFunctionRef<void(FModelImportTimings&)> Func);
+
+    // Turns on Assimp's Profiler (AI_CONFIG_GLOB_MEASURE_TIME) for the next ReadFile and routes its log output
+    // to the profiler current on the calling thread. Turns it off again for pooled importers when bEnable is false
+    static void ConfigureAssimpProfiling(Assimp::Importer& Importer, bool bEnable);
+    // Detaches the Assimp log capture (module shutdown)
+    static void Shutdown();
+
+    static FModelImportProfiler* GetCurrent();
+
+    // Makes a profiler current on this thread for the scope; nesting restores the previous one
+    class FScopedContext
+    {
+    public:
+        explicit FScopedContext(FModelImportProfiler* Profiler);
+        ~FScopedContext();
+    private:
+        FModelImportProfiler* Previous;
+    };
+
+    // Adds the scope's wall time to the current profiler, if there is one
+    class FScopedStage
+    {
+    public:
+        explicit FScopedStage(const TCHAR* InName) : Profiler(GetCurrent()), Name(InName), StartTime(Profiler ? FPlatformTime::Seconds() : 0.0) {}
+        ~FScopedStage() { if (Profiler) Profiler->AddStage(Name, FPlatformTime::Seconds() - StartTime); }
+    private:
+        FModelImportProfiler* Profiler;
+        const TCHAR* Name;
+        double StartTime;
+    };
+
+private:
+    friend class FAssimpProfilerLogStream;
+    void HandleAssimpLog(const char* Message);
+
+    mutable FCriticalSection Lock;
+    FModelImportTimings Timings;
+    FString CurrentPostProcessStep;     // Last "<Step>Process begin" seen, names the next postprocess profiler region
+};
+
+// Insights event + stat counter + timing record entry for one stage
+#define MODEL_IMPORT_SCOPE(Stage) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("ModelImport::" #Stage, ModelImportChannel); \
+    SCOPE_CYCLE_COUNTER(STAT_ModelImport_##Stage); \
+    FModelImportProfiler::FScopedStage PREPROCESSOR_JOIN(ModelImportStage_, __LINE__)(TEXT(#Stage))
@@ -0,0 +1,173 @@
+// Import presets and per-model import settings: which Assimp postprocess steps run and how ExtractMesh builds the mesh streams
+#include "ModelImportSettings.h"
+#include "assimp/postprocess.h"
+#include "Hash/xxhash.h"
+
+FModelImportSettings FModelImportSettings::FromPreset(EModelImportPreset InPreset)
+{
+	FModelImportSettings Settings;
+	Settings.ApplyPreset(InPreset);
+	return Settings;
+}
+
+bool FModelImportSettings::ParsePreset(const FString& PresetName, EModelImportPreset& OutPreset)
+{
+	const int64 Value = StaticEnum<EModelImportPreset>()->GetValueByNameString(PresetName);
+	if (Value == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutPreset = static_cast<EModelImportPreset>(Value);
+	return true;
+}
+
+bool FModelImportSettings::ParseSpawnBackend(const FString& BackendName, EModelSpawnBackend& OutBackend)
+{
+	const int64 Value = StaticEnum<EModelSpawnBackend>()->GetValueByNameString(BackendName);
+	if (Value == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutBackend = static_cast<EModelSpawnBackend>(Value);
+	return true;
+}
+
+bool FModelImportSettings::ParseSpawnHierarchy(const FString& HierarchyName, EModelSpawnHierarchy& OutHierarchy)
+{
+	const int64 Value = StaticEnum<EModelSpawnHierarchy>()->GetValueByNameString(HierarchyName);
+	if (Value == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutHierarchy = static_cast<EModelSpawnHierarchy>(Value);
+	return true;
+}
+
+bool FModelImportSettings::ParseCollisionMode(const FString& ModeName, EModelCollisionMode& OutMode)
+{
+	const int64 Value = StaticEnum<EModelCollisionMode>()->GetValueByNameString(ModeName);
+	if (Value == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutMode = static_cast<EModelCollisionMode>(Value);
+	return true;
+}
+
+void FModelImportSettings::ApplyPreset(EModelImportPreset InPreset)
+{
+	Preset = InPreset;
+
+	switch (InPreset)
+	{
+	case EModelImportPreset::FastPreview:
+		// No vertex welding, no reordering and no tangent space: ReadFile is little more than parsing
+		PostProcessFlags =
+			aiProcess_Triangulate |
+			aiProcess_GenNormals |
+			aiProcess_FlipUVs;
+		bImportUVs = true;
+		bComputeTangents = false;
+		bOptimizeVertexCache = false;
+		bOptimizeOverdraw = false;
+		bParallelWeldAndNormals = false;
+		break;
+
+	case EModelImportPreset::Balanced:
+		// Welded, smooth-enough geometry; skips Assimp's mesh merging, which is among the slowest steps on CAD exports
+		PostProcessFlags =
+			aiProcess_Triangulate |
+			aiProcess_GenNormals |
+			aiProcess_CalcTangentSpace |
+			aiProcess_JoinIdenticalVertices |
+			aiProcess_FlipUVs;
+		bImportUVs = true;
+		bComputeTangents = true;
+		bOptimizeVertexCache = true;
+		bOptimizeOverdraw = false;
+		bParallelWeldAndNormals = false;
+		break;
+
+	case EModelImportPreset::ShippingQuality:
+	case EModelImportPreset::Custom:
+	default:
+		// aiProcess_ImproveCacheLocality is left out: FModelMeshOptimizer reorders the final buffers after extraction
+		PostProcessFlags =
+			aiProcess_Triangulate |
+			aiProcess_GenNormals |
+			aiProcess_CalcTangentSpace |
+			aiProcess_JoinIdenticalVertices |
+			aiProcess_OptimizeMeshes |
+			aiProcess_FlipUVs;
+		bImportUVs = true;
+		bComputeTangents = true;
+		bOptimizeVertexCache = true;
+		bOptimizeOverdraw = true;
+		bParallelWeldAndNormals = false;
+		break;
+	}
+}
+
+float FModelImportSettings::GetLODScreenSize(int32 LODIndex) const
+{
+	if (LODIndex <= 0)
+	{
+		return 1.f;
+	}
+	if (LODScreenSizes.IsValidIndex(LODIndex - 1))
+	{
+		return LODScreenSizes[LODIndex - 1];
+	}
+
+	// Screen size is a radius, so keeping triangle density per pixel means scaling by the square root of the triangle ratio
+	return GetLODScreenSize(LODIndex - 1) * FMath::Sqrt(FMath::Clamp(LODReductionRatio, 0.01f, 1.f));
+}
+
+uint32 FModelImportSettings::GetReadFileFlags() const
+{
+	uint32 Flags = PostProcessFlags;
+	if (bParallelWeldAndNormals)
+	{
+		// Tangents go too: Assimp would compute them on the unwelded mesh, FModelTangentGenerator redoes them after welding
+		Flags &= ~(aiProcess_JoinIdenticalVertices | aiProcess_GenNormals | aiProcess_GenSmoothNormals | aiProcess_CalcTangentSpace);
+	}
+	return Flags;
+}
+
+uint64 FModelImportSettings::GetCacheKey() const
+{
+	const uint64 KeyParts[] =
+	{
+		GetReadFileFlags(),
+		bParallelWeldAndNormals,
+		static_cast<uint64>(FMath::RoundToInt64(WeldTolerance * 1000000.0)),
+		static_cast<uint64>(FMath::RoundToInt(NormalCreaseAngle * 100.f)),
+		bRecomputeNormals,
+		static_cast<uint64>(SpatialChunkVertices),
+		bImportUVs,
+		bComputeTangents,
+		bOptimizeVertexCache,
+		bOptimizeOverdraw,
+		static_cast<uint64>(NumLODs),
+		static_cast<uint64>(FMath::RoundToInt(LODReductionRatio * 10000.f)),
+		bQuantizeVertices,
+		bQuantizePositions
+	};
+	return FXxHash64::HashBuffer(KeyParts, sizeof(KeyParts)).Hash;
+}
+
+uint64 FModelImportSettings::GetCollisionKey() const
+{
+	const uint64 KeyParts[] =
+	{
+		GetCacheKey(),
+		static_cast<uint64>(MaxConvexHulls),
+		static_cast<uint64>(DecompositionResolution),
+		static_cast<uint64>(FMath::RoundToInt(DecompositionConcavity * 100000.f))
+	};
+	return FXxHash64::HashBuffer(KeyParts, sizeof(KeyParts)).Hash;
+}
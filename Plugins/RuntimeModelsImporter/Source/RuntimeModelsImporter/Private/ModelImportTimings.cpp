@@ -0,0 +1,100 @@
+// Per-import timing record (stage times, model size counters, Assimp profiler output) with JSON/CSV export
+#include "ModelImportTimings.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+void FModelImportTimings::AddStage(const FString& Name, double Seconds)
+{
+	FModelImportStageTiming* Stage = Stages.FindByPredicate([&Name](const FModelImportStageTiming& Existing) { return Existing.Name == Name; });
+	if (!Stage)
+	{
+		Stage = &Stages.AddDefaulted_GetRef();
+		Stage->Name = Name;
+	}
+	Stage->Seconds += Seconds;
+	++Stage->Calls;
+}
+
+double FModelImportTimings::GetStageSeconds(const FString& Name) const
+{
+	const FModelImportStageTiming* Stage = Stages.FindByPredicate([&Name](const FModelImportStageTiming& Existing) { return Existing.Name == Name; });
+	return Stage ? Stage->Seconds : 0.0;
+}
+
+TSharedRef<FJsonObject> FModelImportTimings::ToJsonObject() const
+{
+	TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+	Object->SetStringField(TEXT("File"), FilePath);
+	Object->SetBoolField(TEXT("Success"), bSuccess);
+	Object->SetBoolField(TEXT("FromCache"), bLoadedFromCache);
+	Object->SetNumberField(TEXT("TotalSeconds"), TotalSeconds);
+	Object->SetNumberField(TEXT("SourceBytes"), static_cast<double>(SourceBytes));
+	Object->SetNumberField(TEXT("MeshSections"), NumMeshSections);
+	Object->SetNumberField(TEXT("UniqueMeshes"), NumUniqueMeshes);
+	Object->SetNumberField(TEXT("Vertices"), NumVertices);
+	Object->SetNumberField(TEXT("Triangles"), NumTriangles);
+	Object->SetNumberField(TEXT("Materials"), NumMaterials);
+
+	TSharedRef<FJsonObject> StagesObject = MakeShared<FJsonObject>();
+	for (const FModelImportStageTiming& Stage : Stages)
+	{
+		TSharedRef<FJsonObject> StageObject = MakeShared<FJsonObject>();
+		StageObject->SetNumberField(TEXT("Seconds"), Stage.Seconds);
+		StageObject->SetNumberField(TEXT("Calls"), Stage.Calls);
+		StagesObject->SetObjectField(Stage.Name, StageObject);
+	}
+	Object->SetObjectField(TEXT("Stages"), StagesObject);
+
+	TArray<TSharedPtr<FJsonValue>> ProfilerLines;
+	for (const FString& Line : AssimpProfilerLines)
+	{
+		ProfilerLines.Add(MakeShared<FJsonValueString>(Line));
+	}
+	Object->SetArrayField(TEXT("AssimpProfiler"), ProfilerLines);
+	return Object;
+}
+
+FString FModelImportTimings::ToJson(const TArray<FModelImportTimings>& Timings)
+{
+	TArray<TSharedPtr<FJsonValue>> Imports;
+	for (const FModelImportTimings& Import : Timings)
+	{
+		Imports.Add(MakeShared<FJsonValueObject>(Import.ToJsonObject()));
+	}
+
+	FString Output;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Imports, Writer);
+	return Output;
+}
+
+FString FModelImportTimings::ToCsv(const TArray<FModelImportTimings>& Timings)
+{
+	FString Output = TEXT("File,Success,FromCache,Stage,Seconds,Calls\n");
+	for (const FModelImportTimings& Import : Timings)
+	{
+		const FString File = FString::Printf(TEXT("\"%s\",%d,%d"), *Import.FilePath.Replace(TEXT("\""), TEXT("\"\"")), Import.bSuccess ? 1 : 0, Import.bLoadedFromCache ? 1 : 0);
+		for (const FModelImportStageTiming& Stage : Import.Stages)
+		{
+			Output += FString::Printf(TEXT("%s,%s,%.6f,%d\n"), *File, *Stage.Name, Stage.Seconds, Stage.Calls);
+		}
+		Output += FString::Printf(TEXT("%s,TOTAL,%.6f,1\n"), *File, Import.TotalSeconds);
+	}
+	return Output;
+}
+
+bool FModelImportTimings::SaveToFile(const TArray<FModelImportTimings>& Timings, const FString& Path)
+{
+	const bool bCsv = FPaths::GetExtension(Path).Equals(TEXT("csv"), ESearchCase::IgnoreCase);
+	if (!FFileHelper::SaveStringToFile(bCsv ? ToCsv(Timings) : ToJson(Timings), *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ Failed to write import timings: %s"), *Path);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("✅ Wrote import timings for %d model(s): %s"), Timings.Num(), *Path);
+	return true;
+}
@@ -0,0 +1,164 @@
+// Spatial partitioning of oversized meshes into independently culled sections
+#include "ModelMeshChunker.h"
+#include "ModelMeshData.h"
+#include "ModelImportProfiler.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+#include "Algo/Unique.h"
+#include "Algo/BinarySearch.h"
+#include <algorithm>
+
+TArray<TSharedPtr<FModelMeshData>> FModelMeshChunker::Split(const FModelMeshData& Mesh, int32 MaxChunkVertices)
+{
+	MODEL_IMPORT_SCOPE(ChunkMesh);
+	check(!Mesh.IsQuantized() && Mesh.LODIndices.Num() == 0);
+
+	const int32 NumTriangles = Mesh.GetNumTriangles();
+	TArrayView<const FVector3f> Positions = Mesh.GetPositions();
+	TArrayView<const int32> Indices = Mesh.GetIndices();
+
+	// Vertex counts are only known once a piece is built, so the cut stops on the triangle count with the mesh's own ratio
+	const int64 TargetTriangles = FMath::Max<int64>(1, static_cast<int64>(NumTriangles) * FMath::Max(1, MaxChunkVertices) / FMath::Max(1, Mesh.GetNumVertices()));
+
+	TArray<FVector3f> Centroids;
+	Centroids.SetNumUninitialized(NumTriangles);
+	ParallelFor(FMath::DivideAndRoundUp(NumTriangles, TrianglesPerBatch), [&](int32 Batch)
+		{
+			const int32 End = FMath::Min(NumTriangles, (Batch + 1) * TrianglesPerBatch);
+			for (int32 Triangle = Batch * TrianglesPerBatch; Triangle < End; ++Triangle)
+			{
+				Centroids[Triangle] = (Positions[Indices[Triangle * 3]] + Positions[Indices[Triangle * 3 + 1]] + Positions[Indices[Triangle * 3 + 2]]) / 3.f;
+			}
+		});
+
+	TArray<int32> Triangles;
+	Triangles.SetNumUninitialized(NumTriangles);
+	for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+	{
+		Triangles[Triangle] = Triangle;
+	}
+
+	// --- Median cuts, one level at a time; ranges on a level are disjoint, so each level splits them in parallel ---
+	TArray<TPair<int32, int32>> Ranges; // [Start, End) into Triangles, kept in order
+	Ranges.Emplace(0, NumTriangles);
+	for (;;)
+	{
+		TArray<int32> ToSplit;
+		for (int32 i = 0; i < Ranges.Num(); ++i)
+		{
+			if (Ranges[i].Value - Ranges[i].Key > TargetTriangles)
+			{
+				ToSplit.Add(i);
+			}
+		}
+		if (ToSplit.Num() == 0)
+		{
+			break;
+		}
+
+		TArray<int32> Mids;
+		Mids.SetNumUninitialized(ToSplit.Num());
+		ParallelFor(ToSplit.Num(), [&](int32 i)
+			{
+				const int32 Start = Ranges[ToSplit[i]].Key;
+				const int32 End = Ranges[ToSplit[i]].Value;
+
+				FBox3f Bounds(ForceInit);
+				for (int32 j = Start; j < End; ++j)
+				{
+					Bounds += Centroids[Triangles[j]];
+				}
+				const FVector3f Extent = Bounds.GetSize();
+				const int32 Axis = Extent.X >= Extent.Y && Extent.X >= Extent.Z ? 0 : (Extent.Y >= Extent.Z ? 1 : 2);
+
+				// Ties broken by index so the cut does not depend on the partition's internal order
+				const int32 Mid = Start + (End - Start) / 2;
+				std::nth_element(Triangles.GetData() + Start, Triangles.GetData() + Mid, Triangles.GetData() + End,
+					[&Centroids, Axis](int32 A, int32 B)
+					{
+						return Centroids[A][Axis] != Centroids[B][Axis] ? Centroids[A][Axis] < Centroids[B][Axis] : A < B;
+					});
+				Mids[i] = Mid;
+			});
+
+		TArray<TPair<int32, int32>> NextRanges;
+		NextRanges.Reserve(Ranges.Num() + ToSplit.Num());
+		int32 NextSplit = 0;
+		for (int32 i = 0; i < Ranges.Num(); ++i)
+		{
+			if (NextSplit < ToSplit.Num() && ToSplit[NextSplit] == i)
+			{
+				NextRanges.Emplace(Ranges[i].Key, Mids[NextSplit]);
+				NextRanges.Emplace(Mids[NextSplit], Ranges[i].Value);
+				++NextSplit;
+			}
+			else
+			{
+				NextRanges.Add(Ranges[i]);
+			}
+		}
+		Ranges = MoveTemp(NextRanges);
+	}
+
+	// --- Build the pieces ---
+	TArray<TSharedPtr<FModelMeshData>> Chunks;
+	Chunks.SetNum(Ranges.Num());
+	FModelImportProfiler* Profiler = FModelImportProfiler::GetCurrent();
+	ParallelFor(Ranges.Num(), [&](int32 i)
+		{
+			FModelImportProfiler::FScopedContext ProfilerContext(Profiler);
+			Chunks[i] = MakeShared<FModelMeshData>();
+			BuildChunk(Mesh, TArrayView<int32>(Triangles.GetData() + Ranges[i].Key, Ranges[i].Value - Ranges[i].Key), *Chunks[i]);
+		});
+	return Chunks;
+}
+
+void FModelMeshChunker::BuildChunk(const FModelMeshData& Mesh, TArrayView<int32> Triangles, FModelMeshData& OutChunk)
+{
+	TArrayView<const int32> Indices = Mesh.GetIndices();
+
+	// Source triangle order, which is what the optimizer and the simplifier saw before the split
+	Algo::Sort(Triangles);
+
+	TArray<int32> Vertices;
+	Vertices.Reserve(Triangles.Num() * 3);
+	for (int32 Triangle : Triangles)
+	{
+		Vertices.Add(Indices[Triangle * 3]);
+		Vertices.Add(Indices[Triangle * 3 + 1]);
+		Vertices.Add(Indices[Triangle * 3 + 2]);
+	}
+	Algo::Sort(Vertices);
+	Vertices.SetNum(Algo::Unique(Vertices), EAllowShrinking::No);
+
+	OutChunk.MaterialName = Mesh.MaterialName;
+	OutChunk.MaterialIndex = Mesh.MaterialIndex;
+	OutChunk.Material = Mesh.Material;
+	OutChunk.Allocate(Vertices.Num(), Triangles.Num() * 3, Mesh.GetStreams());
+
+	TArrayView<int32> ChunkIndices = OutChunk.GetIndices();
+	for (int32 i = 0; i < Triangles.Num(); ++i)
+	{
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			ChunkIndices[i * 3 + Corner] = Algo::LowerBound(Vertices, Indices[Triangles[i] * 3 + Corner]);
+		}
+	}
+
+	TArrayView<const FVector3f> Positions = Mesh.GetPositions();
+	TArrayView<const FVector3f> Normals = Mesh.GetNormals();
+	TArrayView<const FModelTangentFrame> Tangents = Mesh.GetTangents();
+	TArrayView<const FVector2f> UVs = Mesh.GetUVs();
+	TArrayView<FVector3f> ChunkPositions = OutChunk.GetPositions();
+	TArrayView<FVector3f> ChunkNormals = OutChunk.GetNormals();
+	TArrayView<FModelTangentFrame> ChunkTangents = OutChunk.GetTangents();
+	TArrayView<FVector2f> ChunkUVs = OutChunk.GetUVs();
+	for (int32 i = 0; i < Vertices.Num(); ++i)
+	{
+		const int32 Source = Vertices[i];
+		ChunkPositions[i] = Positions[Source];
+		if (ChunkNormals.Num() > 0) ChunkNormals[i] = Normals[Source];
+		if (ChunkTangents.Num() > 0) ChunkTangents[i] = Tangents[Source];
+		if (ChunkUVs.Num() > 0) ChunkUVs[i] = UVs[Source];
+	}
+}
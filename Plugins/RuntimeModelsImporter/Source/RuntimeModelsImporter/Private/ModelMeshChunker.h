@@ -0,0 +1,20 @@
+// Spatial partitioning of oversized meshes into independently culled sections
+#pragma once
+#include "CoreMinimal.h"
+
+struct FModelMeshData;
+
+class FModelMeshChunker
+{
+public:
+    // Splits a float-format mesh (before LODs and quantization) into spatially compact pieces of at most about
+    // MaxChunkVertices vertices each, by recursive median cuts of the triangle centroids along the longest axis.
+    // Each piece keeps the material and every stream of Mesh; vertices on a cut are duplicated so shading stays seamless
+    static TArray<TSharedPtr<FModelMeshData>> Split(const FModelMeshData& Mesh, int32 MaxChunkVertices);
+
+private:
+    // Builds one piece from a range of triangle indices of Mesh
+    static void BuildChunk(const FModelMeshData& Mesh, TArrayView<int32> Triangles, FModelMeshData& OutChunk);
+
+    static constexpr int32 TrianglesPerBatch = 16384;
+};
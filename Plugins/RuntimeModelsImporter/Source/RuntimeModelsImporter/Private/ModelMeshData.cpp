@@ -0,0 +1,214 @@
+// Compact mesh section storage: vertex streams and indices packed into one allocation per mesh, optionally quantized
+#include "ModelMeshData.h"
+
+void FModelMeshData::UpdateOffsets()
+{
+	const bool bQuantized = IsQuantized();
+	const int64 PositionSize = bQuantizedPositions ? sizeof(FModelPackedPosition) : sizeof(FVector3f);
+	const int64 NormalSize = bQuantized ? sizeof(uint32) : sizeof(FVector3f);
+	const int64 TangentSize = bQuantized ? sizeof(uint32) : sizeof(FModelTangentFrame);
+	const int64 UVSize = bQuantized ? sizeof(FVector2DHalf) : sizeof(FVector2f);
+
+	// Every stream starts 4-byte aligned (packed positions are 6 bytes per vertex)
+	int64 Offset = 0;
+	auto Place = [&Offset, this](int64 ElementSize, bool bPresent)
+		{
+			const int64 StreamOffset = Offset;
+			Offset = Align(Offset + (bPresent ? ElementSize * NumVertices : 0), 4);
+			return StreamOffset;
+		};
+
+	PositionsOffset = Place(PositionSize, true);
+	NormalsOffset = Place(NormalSize, HasStream(EModelMeshStreams::Normals));
+	TangentsOffset = Place(TangentSize, HasStream(EModelMeshStreams::Tangents));
+	UVsOffset = Place(UVSize, HasStream(EModelMeshStreams::UVs));
+	IndicesOffset = Offset;
+}
+
+void FModelMeshData::Allocate(int32 InNumVertices, int32 InNumIndices, EModelMeshStreams InStreams)
+{
+	check(InNumVertices >= 0 && InNumIndices >= 0);
+
+	NumVertices = InNumVertices;
+	NumIndices = InNumIndices;
+	IndexCapacity = InNumIndices;
+	Streams = InStreams;
+	VertexFormat = EModelVertexFormat::Float;
+	bQuantizedPositions = false;
+	PositionMin = FVector3f::ZeroVector;
+	PositionScale = FVector3f::ZeroVector;
+	UpdateOffsets();
+
+	Buffer.Empty();
+	Buffer.SetNumUninitialized(IndicesOffset + static_cast<int64>(IndexCapacity) * sizeof(int32));
+}
+
+void FModelMeshData::ShrinkIndices(int32 InNumIndices)
+{
+	check(InNumIndices >= 0 && InNumIndices <= IndexCapacity);
+	NumIndices = InNumIndices;
+}
+
+void FModelMeshData::Reset()
+{
+	Allocate(0, 0, EModelMeshStreams::None);
+}
+
+void FModelMeshData::Quantize(bool bPositions)
+{
+	if (IsQuantized())
+	{
+		return;
+	}
+
+	// Build the quantized block next to the float one, then swap. Everything outside the vertex block comes back as is
+	const int32 NumLODs = GetNumLODs();
+	FModelMeshData Source = MoveTemp(*this);
+	MaterialName = MoveTemp(Source.MaterialName);
+	MaterialIndex = Source.MaterialIndex;
+	Material = Source.Material;
+	LODIndices = MoveTemp(Source.LODIndices);
+
+	NumVertices = Source.NumVertices;
+	NumIndices = Source.NumIndices;
+	IndexCapacity = Source.NumIndices;
+	Streams = Source.Streams;
+	VertexFormat = EModelVertexFormat::Quantized;
+	bQuantizedPositions = bPositions && NumVertices > 0;
+	UpdateOffsets();
+	Buffer.SetNumUninitialized(IndicesOffset + static_cast<int64>(NumIndices) * sizeof(int32));
+
+	TArrayView<const FVector3f> SourcePositions = Source.GetPositions();
+	if (bQuantizedPositions)
+	{
+		const FBox3f Bounds(SourcePositions.GetData(), SourcePositions.Num());
+		PositionMin = Bounds.Min;
+		PositionScale = (Bounds.Max - Bounds.Min) / 65535.f;
+
+		const FVector3f InvScale(
+			PositionScale.X > 0.f ? 1.f / PositionScale.X : 0.f,
+			PositionScale.Y > 0.f ? 1.f / PositionScale.Y : 0.f,
+			PositionScale.Z > 0.f ? 1.f / PositionScale.Z : 0.f);
+
+		TArrayView<FModelPackedPosition> Packed = GetStream<FModelPackedPosition>(PositionsOffset, NumVertices);
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			const FVector3f Local = (SourcePositions[i] - PositionMin) * InvScale;
+			Packed[i].X = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Local.X), 0, 65535));
+			Packed[i].Y = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Local.Y), 0, 65535));
+			Packed[i].Z = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Local.Z), 0, 65535));
+		}
+	}
+	else
+	{
+		FMemory::Memcpy(GetPositions().GetData(), SourcePositions.GetData(), SourcePositions.Num() * sizeof(FVector3f));
+	}
+
+	TArrayView<const FVector3f> SourceNormals = Source.GetNormals();
+	TArrayView<uint32> PackedNormals = GetStream<uint32>(NormalsOffset, SourceNormals.Num());
+	for (int32 i = 0; i < SourceNormals.Num(); ++i)
+	{
+		PackedNormals[i] = FModelVertexQuantization::EncodeUnitVector(SourceNormals[i]);
+	}
+
+	TArrayView<const FModelTangentFrame> SourceTangents = Source.GetTangents();
+	TArrayView<uint32> PackedTangents = GetStream<uint32>(TangentsOffset, SourceTangents.Num());
+	for (int32 i = 0; i < SourceTangents.Num(); ++i)
+	{
+		PackedTangents[i] = FModelVertexQuantization::EncodeTangentFrame(SourceTangents[i]);
+	}
+
+	TArrayView<const FVector2f> SourceUVs = Source.GetUVs();
+	TArrayView<FVector2DHalf> PackedUVs = GetStream<FVector2DHalf>(UVsOffset, SourceUVs.Num());
+	for (int32 i = 0; i < SourceUVs.Num(); ++i)
+	{
+		PackedUVs[i] = FVector2DHalf(SourceUVs[i].X, SourceUVs[i].Y);
+	}
+
+	FMemory::Memcpy(GetIndices().GetData(), Source.GetIndices().GetData(), NumIndices * sizeof(int32));
+	check(GetNumLODs() == NumLODs);
+}
+
+FVector3f FModelMeshData::GetPosition(int32 Index) const
+{
+	if (bQuantizedPositions)
+	{
+		const FModelPackedPosition& Packed = GetElement<FModelPackedPosition>(PositionsOffset, Index);
+		return PositionMin + FVector3f(Packed.X, Packed.Y, Packed.Z) * PositionScale;
+	}
+	return GetElement<FVector3f>(PositionsOffset, Index);
+}
+
+FVector3f FModelMeshData::GetNormal(int32 Index) const
+{
+	if (!HasStream(EModelMeshStreams::Normals))
+	{
+		return FVector3f::UpVector;
+	}
+	return IsQuantized()
+		? FModelVertexQuantization::DecodeUnitVector(GetElement<uint32>(NormalsOffset, Index))
+		: GetElement<FVector3f>(NormalsOffset, Index);
+}
+
+FModelTangentFrame FModelMeshData::GetTangent(int32 Index) const
+{
+	if (!HasStream(EModelMeshStreams::Tangents))
+	{
+		return FModelTangentFrame();
+	}
+	return IsQuantized()
+		? FModelVertexQuantization::DecodeTangentFrame(GetElement<uint32>(TangentsOffset, Index))
+		: GetElement<FModelTangentFrame>(TangentsOffset, Index);
+}
+
+FVector2f FModelMeshData::GetUV(int32 Index) const
+{
+	if (!HasStream(EModelMeshStreams::UVs))
+	{
+		return FVector2f::ZeroVector;
+	}
+	if (IsQuantized())
+	{
+		const FVector2DHalf& Packed = GetElement<FVector2DHalf>(UVsOffset, Index);
+		return FVector2f(Packed.X.GetFloat(), Packed.Y.GetFloat());
+	}
+	return GetElement<FVector2f>(UVsOffset, Index);
+}
+
+void FModelMeshData::SerializeStreams(FArchive& Ar)
+{
+	uint8 StreamBits = static_cast<uint8>(Streams);
+	uint8 FormatValue = static_cast<uint8>(VertexFormat);
+	Ar << NumVertices << NumIndices << StreamBits << FormatValue << bQuantizedPositions << PositionMin << PositionScale;
+
+	if (Ar.IsLoading())
+	{
+		if (NumVertices < 0 || NumIndices < 0 || FormatValue > static_cast<uint8>(EModelVertexFormat::Quantized))
+		{
+			Ar.SetError();
+			Reset();
+			return;
+		}
+		Streams = static_cast<EModelMeshStreams>(StreamBits);
+		VertexFormat = static_cast<EModelVertexFormat>(FormatValue);
+		IndexCapacity = NumIndices;
+		UpdateOffsets();
+	}
+
+	// Index slack left by ShrinkIndices is not written
+	const int64 NumBytes = IndicesOffset + static_cast<int64>(NumIndices) * sizeof(int32);
+	if (Ar.IsLoading())
+	{
+		if (NumBytes > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			Reset();
+			return;
+		}
+		Buffer.Empty();
+		Buffer.SetNumUninitialized(NumBytes);
+	}
+
+	// One raw block: loading is a single memcpy out of the mapped cache file
+	Ar.Serialize(Buffer.GetData(), NumBytes);
+}
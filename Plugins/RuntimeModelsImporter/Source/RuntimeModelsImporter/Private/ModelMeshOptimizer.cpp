@@ -0,0 +1,334 @@
+// Post-extraction index and vertex reordering: post-transform vertex cache (Tipsify), overdraw and vertex fetch locality
+#include "ModelMeshOptimizer.h"
+#include "ModelMeshData.h"
+#include "ModelImportProfiler.h"
+#include "Algo/StableSort.h"
+
+// FIFO cache simulation: a vertex is resident while fewer than CacheSize misses happened since it was loaded
+struct FVertexCacheSimulator
+{
+	TArray<int32> LoadedAt;
+	int32 Misses = 0;
+	int32 CacheSize;
+
+	FVertexCacheSimulator(int32 NumVertices, int32 InCacheSize)
+		: CacheSize(InCacheSize)
+	{
+		LoadedAt.Init(MIN_int32 / 2, NumVertices);
+	}
+
+	int32 AddTriangle(const int32* Triangle)
+	{
+		int32 TriangleMisses = 0;
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			int32& Time = LoadedAt[Triangle[Corner]];
+			if (Misses - Time > CacheSize)
+			{
+				Time = Misses++;
+				++TriangleMisses;
+			}
+		}
+		return TriangleMisses;
+	}
+
+	void Flush()
+	{
+		Misses += CacheSize;
+	}
+};
+
+template <typename T>
+static void RemapStream(TArrayView<T> Stream, const TArray<int32>& Remap)
+{
+	if (Stream.Num() == 0)
+	{
+		return;
+	}
+
+	const TArray<T> Source(Stream.GetData(), Stream.Num());
+	for (int32 i = 0; i < Source.Num(); ++i)
+	{
+		Stream[Remap[i]] = Source[i];
+	}
+}
+
+void FModelMeshOptimizer::OptimizeMesh(FModelMeshData& Mesh, bool bOptimizeOverdraw)
+{
+	MODEL_IMPORT_SCOPE(OptimizeMesh);
+	check(!Mesh.IsQuantized());
+
+	if (Mesh.GetNumTriangles() < 2)
+	{
+		return;
+	}
+
+	TArray<int32> Clusters;
+	OptimizeVertexCache(Mesh.GetIndices(), Mesh.GetNumVertices(), bOptimizeOverdraw ? &Clusters : nullptr);
+	if (bOptimizeOverdraw)
+	{
+		OptimizeOverdraw(Mesh.GetIndices(), Mesh.GetPositions(), Clusters);
+	}
+	OptimizeVertexFetch(Mesh);
+}
+
+void FModelMeshOptimizer::OptimizeVertexCache(TArrayView<int32> Indices, int32 NumVertices, TArray<int32>* OutClusters)
+{
+	const int32 NumTriangles = Indices.Num() / 3;
+
+	// --- Vertex -> triangle adjacency (CSR) and live triangle counts ---
+	TArray<int32> LiveTriangles;
+	LiveTriangles.SetNumZeroed(NumVertices);
+	for (int32 Index : Indices)
+	{
+		++LiveTriangles[Index];
+	}
+
+	TArray<int32> AdjacencyOffsets;
+	AdjacencyOffsets.SetNumUninitialized(NumVertices + 1);
+	AdjacencyOffsets[0] = 0;
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		AdjacencyOffsets[Vertex + 1] = AdjacencyOffsets[Vertex] + LiveTriangles[Vertex];
+	}
+
+	TArray<int32> Adjacency;
+	Adjacency.SetNumUninitialized(Indices.Num());
+	TArray<int32> FillCursor(AdjacencyOffsets.GetData(), NumVertices);
+	for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+	{
+		for (int32 Corner = 0; Corner < 3; ++Corner)
+		{
+			Adjacency[FillCursor[Indices[Triangle * 3 + Corner]]++] = Triangle;
+		}
+	}
+
+	// --- Tipsify: fan around the best cached vertex, jump back through the dead-end stack when stuck ---
+	TArray<int32> CacheTime;
+	CacheTime.SetNumZeroed(NumVertices);
+	TBitArray<> Emitted(false, NumTriangles);
+	TArray<int32> DeadEnds;
+	TArray<int32> Candidates;
+	TArray<int32> Output;
+	Output.Reserve(Indices.Num());
+
+	int32 Timestamp = VertexCacheSize + 1;
+	int32 Cursor = 0;
+	int32 Fan = Indices[0];
+	bool bFromDeadEnd = true;
+
+	while (Fan >= 0)
+	{
+		if (bFromDeadEnd && OutClusters)
+		{
+			OutClusters->Add(Output.Num() / 3);
+		}
+
+		Candidates.Reset();
+		for (int32 Slot = AdjacencyOffsets[Fan]; Slot < AdjacencyOffsets[Fan + 1]; ++Slot)
+		{
+			const int32 Triangle = Adjacency[Slot];
+			if (Emitted[Triangle])
+			{
+				continue;
+			}
+			Emitted[Triangle] = true;
+
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 Vertex = Indices[Triangle * 3 + Corner];
+				Output.Add(Vertex);
+				DeadEnds.Add(Vertex);
+				Candidates.Add(Vertex);
+				--LiveTriangles[Vertex];
+				if (Timestamp - CacheTime[Vertex] > VertexCacheSize)
+				{
+					CacheTime[Vertex] = Timestamp++;
+				}
+			}
+		}
+
+		// Prefer the candidate that stays in cache longest while its remaining fan still fits
+		int32 Best = INDEX_NONE;
+		int32 BestPriority = -1;
+		for (int32 Vertex : Candidates)
+		{
+			if (LiveTriangles[Vertex] <= 0)
+			{
+				continue;
+			}
+			const int32 Age = Timestamp - CacheTime[Vertex];
+			const int32 Priority = Age + 2 * LiveTriangles[Vertex] <= VertexCacheSize ? Age : 0;
+			if (Priority > BestPriority)
+			{
+				Best = Vertex;
+				BestPriority = Priority;
+			}
+		}
+
+		bFromDeadEnd = Best == INDEX_NONE;
+		if (bFromDeadEnd)
+		{
+			while (DeadEnds.Num() > 0 && Best == INDEX_NONE)
+			{
+				const int32 Vertex = DeadEnds.Pop(EAllowShrinking::No);
+				if (LiveTriangles[Vertex] > 0)
+				{
+					Best = Vertex;
+				}
+			}
+			while (Cursor < NumVertices && Best == INDEX_NONE)
+			{
+				if (LiveTriangles[Cursor] > 0)
+				{
+					Best = Cursor;
+				}
+				++Cursor;
+			}
+		}
+		Fan = Best;
+	}
+
+	check(Output.Num() == Indices.Num());
+	FMemory::Memcpy(Indices.GetData(), Output.GetData(), Output.Num() * sizeof(int32));
+}
+
+void FModelMeshOptimizer::OptimizeOverdraw(TArrayView<int32> Indices, TArrayView<const FVector3f> Positions, const TArray<int32>& Clusters, float Threshold)
+{
+	const int32 NumTriangles = Indices.Num() / 3;
+	if (Clusters.Num() == 0 || NumTriangles == 0)
+	{
+		return;
+	}
+
+	// --- Soft boundaries: split hard clusters wherever the run so far is already about as cache-friendly as the mesh ---
+	const float MeshACMR = ComputeACMR(Indices, Positions.Num());
+	TArray<int32> Boundaries;
+	{
+		FVertexCacheSimulator Cache(Positions.Num(), VertexCacheSize);
+		for (int32 ClusterIndex = 0; ClusterIndex < Clusters.Num(); ++ClusterIndex)
+		{
+			const int32 Begin = Clusters[ClusterIndex];
+			const int32 End = ClusterIndex + 1 < Clusters.Num() ? Clusters[ClusterIndex + 1] : NumTriangles;
+
+			int32 RunStart = Begin;
+			int32 RunMisses = 0;
+			Cache.Flush();
+			Boundaries.Add(Begin);
+			for (int32 Triangle = Begin; Triangle < End; ++Triangle)
+			{
+				RunMisses += Cache.AddTriangle(&Indices[Triangle * 3]);
+				const int32 RunLength = Triangle + 1 - RunStart;
+				if (Triangle + 1 < End && RunMisses <= Threshold * MeshACMR * RunLength)
+				{
+					RunStart = Triangle + 1;
+					RunMisses = 0;
+					Cache.Flush();
+					Boundaries.Add(RunStart);
+				}
+			}
+		}
+	}
+
+	// --- Sort key: cluster centroid offset from the mesh centroid along the cluster normal ---
+	FVector3d MeshCentroid = FVector3d::ZeroVector;
+	for (const FVector3f& Position : Positions)
+	{
+		MeshCentroid += FVector3d(Position);
+	}
+	MeshCentroid /= FMath::Max(1, Positions.Num());
+
+	struct FCluster
+	{
+		int32 Begin;
+		int32 End;
+		double SortKey;
+	};
+	TArray<FCluster> SortedClusters;
+	SortedClusters.Reserve(Boundaries.Num());
+	for (int32 ClusterIndex = 0; ClusterIndex < Boundaries.Num(); ++ClusterIndex)
+	{
+		FCluster& Cluster = SortedClusters.AddDefaulted_GetRef();
+		Cluster.Begin = Boundaries[ClusterIndex];
+		Cluster.End = ClusterIndex + 1 < Boundaries.Num() ? Boundaries[ClusterIndex + 1] : NumTriangles;
+
+		FVector3d AreaNormal = FVector3d::ZeroVector;
+		FVector3d WeightedCentroid = FVector3d::ZeroVector;
+		double Area = 0.0;
+		for (int32 Triangle = Cluster.Begin; Triangle < Cluster.End; ++Triangle)
+		{
+			const FVector3d A(Positions[Indices[Triangle * 3 + 0]]);
+			const FVector3d B(Positions[Indices[Triangle * 3 + 1]]);
+			const FVector3d C(Positions[Indices[Triangle * 3 + 2]]);
+			const FVector3d Normal = FVector3d::CrossProduct(B - A, C - A);
+			const double TriangleArea = Normal.Size();
+			AreaNormal += Normal;
+			WeightedCentroid += (A + B + C) * (TriangleArea / 3.0);
+			Area += TriangleArea;
+		}
+
+		const FVector3d Centroid = Area > 0.0 ? WeightedCentroid / Area : MeshCentroid;
+		Cluster.SortKey = FVector3d::DotProduct(Centroid - MeshCentroid, AreaNormal.GetSafeNormal());
+	}
+
+	// Winding only flips the sign of every key, so the order still groups the same clusters together
+	Algo::StableSortBy(SortedClusters, [](const FCluster& Cluster) { return -Cluster.SortKey; });
+
+	TArray<int32> Output;
+	Output.Reserve(Indices.Num());
+	for (const FCluster& Cluster : SortedClusters)
+	{
+		Output.Append(&Indices[Cluster.Begin * 3], (Cluster.End - Cluster.Begin) * 3);
+	}
+	FMemory::Memcpy(Indices.GetData(), Output.GetData(), Output.Num() * sizeof(int32));
+}
+
+void FModelMeshOptimizer::OptimizeVertexFetch(FModelMeshData& Mesh)
+{
+	const int32 NumVertices = Mesh.GetNumVertices();
+	TArrayView<int32> Indices = Mesh.GetIndices();
+
+	// First use in the index buffer decides the new slot; unreferenced vertices keep their relative order at the end
+	TArray<int32> Remap;
+	Remap.Init(INDEX_NONE, NumVertices);
+	int32 NextVertex = 0;
+	for (int32 Index : Indices)
+	{
+		if (Remap[Index] == INDEX_NONE)
+		{
+			Remap[Index] = NextVertex++;
+		}
+	}
+	for (int32& Slot : Remap)
+	{
+		if (Slot == INDEX_NONE)
+		{
+			Slot = NextVertex++;
+		}
+	}
+
+	for (int32& Index : Indices)
+	{
+		Index = Remap[Index];
+	}
+	RemapStream(Mesh.GetPositions(), Remap);
+	RemapStream(Mesh.GetNormals(), Remap);
+	RemapStream(Mesh.GetTangents(), Remap);
+	RemapStream(Mesh.GetUVs(), Remap);
+}
+
+float FModelMeshOptimizer::ComputeACMR(TArrayView<const int32> Indices, int32 NumVertices, int32 CacheSize)
+{
+	const int32 NumTriangles = Indices.Num() / 3;
+	if (NumTriangles == 0)
+	{
+		return 0.f;
+	}
+
+	FVertexCacheSimulator Cache(NumVertices, CacheSize);
+	for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+	{
+		Cache.AddTriangle(&Indices[Triangle * 3]);
+	}
+	return static_cast<float>(Cache.Misses) / NumTriangles;
+}
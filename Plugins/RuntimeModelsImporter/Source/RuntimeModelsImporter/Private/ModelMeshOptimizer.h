@@ -0,0 +1,29 @@
+// Post-extraction index and vertex reordering: post-transform vertex cache (Tipsify), overdraw and vertex fetch locality
+#pragma once
+#include "CoreMinimal.h"
+
+struct FModelMeshData;
+
+class FModelMeshOptimizer
+{
+public:
+    // FIFO cache size the orderings are tuned for; small enough to also suit GPUs with larger or LRU-like caches
+    static constexpr int32 VertexCacheSize = 16;
+
+    // Full chain on a float-format mesh: vertex cache order, then optionally overdraw, then vertex fetch order
+    static void OptimizeMesh(FModelMeshData& Mesh, bool bOptimizeOverdraw);
+
+    // Tipsify (Sander et al. 2007) triangle order. OutClusters, when given, receives the first triangle of every
+    // run that started from a dead end; those are the points where reordering costs no extra cache misses
+    static void OptimizeVertexCache(TArrayView<int32> Indices, int32 NumVertices, TArray<int32>* OutClusters = nullptr);
+
+    // Sorts clusters outside-in by how much they face away from the mesh center, so occluders tend to draw first.
+    // Clusters are split further wherever the local miss ratio allows it within Threshold of the whole mesh's
+    static void OptimizeOverdraw(TArrayView<int32> Indices, TArrayView<const FVector3f> Positions, const TArray<int32>& Clusters, float Threshold = 1.05f);
+
+    // Renumbers vertices in first-use order of the index buffer and permutes every stream to match
+    static void OptimizeVertexFetch(FModelMeshData& Mesh);
+
+    // Average cache miss ratio: vertex shader invocations per triangle on a FIFO cache of CacheSize
+    static float ComputeACMR(TArrayView<const int32> Indices, int32 NumVertices, int32 CacheSize = VertexCacheSize);
+};
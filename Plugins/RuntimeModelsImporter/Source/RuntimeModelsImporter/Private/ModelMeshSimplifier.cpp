@@ -0,0 +1,444 @@
+// Quadric-error edge-collapse simplification of extracted meshes, used to build LOD chains on the import workers
+#include "ModelMeshSimplifier.h"
+#include "ModelMeshData.h"
+#include "ModelImportProfiler.h"
+#include "Algo/Sort.h"
+
+// Sum of weighted squared distances to a set of planes: p'Ap + 2b'p + c, plus the total weight for normalizing
+struct FModelQuadric
+{
+	double A00 = 0.0, A01 = 0.0, A02 = 0.0, A11 = 0.0, A12 = 0.0, A22 = 0.0;
+	double B0 = 0.0, B1 = 0.0, B2 = 0.0;
+	double C = 0.0;
+	double Weight = 0.0;
+
+	// Plane dot(Normal, p) + Distance = 0, Normal unit length
+	void AddPlane(const FVector3d& Normal, double Distance, double InWeight)
+	{
+		A00 += InWeight * Normal.X * Normal.X;
+		A01 += InWeight * Normal.X * Normal.Y;
+		A02 += InWeight * Normal.X * Normal.Z;
+		A11 += InWeight * Normal.Y * Normal.Y;
+		A12 += InWeight * Normal.Y * Normal.Z;
+		A22 += InWeight * Normal.Z * Normal.Z;
+		B0 += InWeight * Normal.X * Distance;
+		B1 += InWeight * Normal.Y * Distance;
+		B2 += InWeight * Normal.Z * Distance;
+		C += InWeight * Distance * Distance;
+		Weight += InWeight;
+	}
+
+	void Add(const FModelQuadric& Other)
+	{
+		A00 += Other.A00; A01 += Other.A01; A02 += Other.A02;
+		A11 += Other.A11; A12 += Other.A12; A22 += Other.A22;
+		B0 += Other.B0; B1 += Other.B1; B2 += Other.B2;
+		C += Other.C;
+		Weight += Other.Weight;
+	}
+
+	double Evaluate(const FVector3d& P) const
+	{
+		const double Result =
+			A00 * P.X * P.X + A11 * P.Y * P.Y + A22 * P.Z * P.Z +
+			2.0 * (A01 * P.X * P.Y + A02 * P.X * P.Z + A12 * P.Y * P.Z) +
+			2.0 * (B0 * P.X + B1 * P.Y + B2 * P.Z) +
+			C;
+		return FMath::Max(Result, 0.0);
+	}
+};
+
+enum class EModelSimplifyVertexKind : uint8
+{
+	Manifold,   // One vertex at this position, surrounded by triangles: collapses freely
+	Seam,       // Two vertices at this position split by an attribute seam: collapses along the seam only
+	Locked      // Mesh border, non-manifold or more complex splits: never moves
+};
+
+static uint64 MakeEdgeKey(int32 From, int32 To)
+{
+	return (static_cast<uint64>(static_cast<uint32>(From)) << 32) | static_cast<uint32>(To);
+}
+
+TArray<int32> FModelMeshSimplifier::Simplify(const FModelMeshData& Mesh, TArrayView<const int32> SourceIndices, int32 TargetTriangles, float MaxDeviation)
+{
+	MODEL_IMPORT_SCOPE(SimplifyMesh);
+
+	const int32 NumVertices = Mesh.GetNumVertices();
+	TArray<int32> Indices(SourceIndices.GetData(), SourceIndices.Num());
+	int32 NumTriangles = Indices.Num() / 3;
+	if (NumTriangles <= TargetTriangles)
+	{
+		return Indices;
+	}
+
+	TArray<FVector3d> Positions;
+	Positions.SetNumUninitialized(NumVertices);
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		Positions[Vertex] = FVector3d(Mesh.GetPosition(Vertex));
+	}
+
+	// --- Vertices sharing a position (attribute splits) link into a ring; the first one found is the position's id ---
+	TArray<int32> PositionIds;
+	TArray<int32> NextAtPosition;
+	PositionIds.SetNumUninitialized(NumVertices);
+	NextAtPosition.SetNumUninitialized(NumVertices);
+	{
+		TMap<FVector3f, int32> FirstAtPosition;
+		FirstAtPosition.Reserve(NumVertices);
+		for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+		{
+			const int32 First = FirstAtPosition.FindOrAdd(Mesh.GetPosition(Vertex), Vertex);
+			PositionIds[Vertex] = First;
+			NextAtPosition[Vertex] = First == Vertex ? Vertex : NextAtPosition[First];
+			if (First != Vertex)
+			{
+				NextAtPosition[First] = Vertex;
+			}
+		}
+	}
+
+	// --- Classify positions: open edges in position space are mesh borders, open edges in vertex space are seams ---
+	TArray<EModelSimplifyVertexKind> Kinds;
+	{
+		TSet<uint64> PositionEdges;
+		TSet<uint64> VertexEdges;
+		PositionEdges.Reserve(Indices.Num());
+		VertexEdges.Reserve(Indices.Num());
+		TBitArray<> NonManifold(false, NumVertices);
+		for (int32 Corner = 0; Corner < Indices.Num(); ++Corner)
+		{
+			const int32 From = Indices[Corner];
+			const int32 To = Indices[Corner - Corner % 3 + (Corner + 1) % 3];
+			bool bAlreadyInSet = false;
+			PositionEdges.Add(MakeEdgeKey(PositionIds[From], PositionIds[To]), &bAlreadyInSet);
+			if (bAlreadyInSet)
+			{
+				NonManifold[PositionIds[From]] = true;
+				NonManifold[PositionIds[To]] = true;
+			}
+			VertexEdges.Add(MakeEdgeKey(From, To));
+		}
+
+		TBitArray<> Border(false, NumVertices);
+		TArray<int32> OpenOut, OpenIn;
+		OpenOut.SetNumZeroed(NumVertices);
+		OpenIn.SetNumZeroed(NumVertices);
+		for (int32 Corner = 0; Corner < Indices.Num(); ++Corner)
+		{
+			const int32 From = Indices[Corner];
+			const int32 To = Indices[Corner - Corner % 3 + (Corner + 1) % 3];
+			if (!PositionEdges.Contains(MakeEdgeKey(PositionIds[To], PositionIds[From])))
+			{
+				Border[PositionIds[From]] = true;
+				Border[PositionIds[To]] = true;
+			}
+			if (!VertexEdges.Contains(MakeEdgeKey(To, From)))
+			{
+				++OpenOut[From];
+				++OpenIn[To];
+			}
+		}
+
+		Kinds.Init(EModelSimplifyVertexKind::Locked, NumVertices);
+		for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+		{
+			if (PositionIds[Vertex] != Vertex || Border[Vertex] || NonManifold[Vertex])
+			{
+				continue;
+			}
+
+			const int32 Sibling = NextAtPosition[Vertex];
+			if (Sibling == Vertex)
+			{
+				Kinds[Vertex] = EModelSimplifyVertexKind::Manifold;
+			}
+			else if (NextAtPosition[Sibling] == Vertex &&
+				OpenOut[Vertex] == 1 && OpenIn[Vertex] == 1 && OpenOut[Sibling] == 1 && OpenIn[Sibling] == 1)
+			{
+				Kinds[Vertex] = EModelSimplifyVertexKind::Seam;
+			}
+		}
+	}
+
+	// --- Quadrics per position: area-weighted triangle planes, plus edge planes that keep seams from wandering ---
+	TArray<FModelQuadric> Quadrics;
+	Quadrics.SetNum(NumVertices);
+	{
+		TSet<uint64> VertexEdges;
+		VertexEdges.Reserve(Indices.Num());
+		for (int32 Corner = 0; Corner < Indices.Num(); ++Corner)
+		{
+			VertexEdges.Add(MakeEdgeKey(Indices[Corner], Indices[Corner - Corner % 3 + (Corner + 1) % 3]));
+		}
+
+		for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			const int32* Corners = &Indices[Triangle * 3];
+			const FVector3d& P0 = Positions[Corners[0]];
+			const FVector3d AreaNormal = FVector3d::CrossProduct(Positions[Corners[1]] - P0, Positions[Corners[2]] - P0);
+			const double DoubleArea = AreaNormal.Size();
+			if (DoubleArea <= UE_DOUBLE_SMALL_NUMBER)
+			{
+				continue;
+			}
+
+			const FVector3d Normal = AreaNormal / DoubleArea;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				Quadrics[PositionIds[Corners[Corner]]].AddPlane(Normal, -FVector3d::DotProduct(Normal, P0), DoubleArea * 0.5);
+			}
+
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const int32 From = Corners[Corner];
+				const int32 To = Corners[(Corner + 1) % 3];
+				if (VertexEdges.Contains(MakeEdgeKey(To, From)))
+				{
+					continue;
+				}
+
+				const FVector3d Edge = Positions[To] - Positions[From];
+				const FVector3d EdgeNormal = FVector3d::CrossProduct(Edge, Normal).GetSafeNormal();
+				const double EdgeWeight = Edge.SizeSquared();
+				const double Distance = -FVector3d::DotProduct(EdgeNormal, Positions[From]);
+				Quadrics[PositionIds[From]].AddPlane(EdgeNormal, Distance, EdgeWeight);
+				Quadrics[PositionIds[To]].AddPlane(EdgeNormal, Distance, EdgeWeight);
+			}
+		}
+	}
+
+	// --- Collapse passes: cheapest edges first, each position touched at most once per pass ---
+	struct FCollapse
+	{
+		int32 From;
+		int32 To;
+		double Error;
+	};
+
+	const double MaxError = FMath::Square(static_cast<double>(MaxDeviation));
+	TArray<FCollapse> Candidates;
+	TArray<int32> Remap;
+	TBitArray<> Touched;
+	TArray<int32> AdjacencyOffsets;
+	TArray<int32> Adjacency;
+	TSet<uint64> VertexEdges;
+
+	while (NumTriangles > TargetTriangles)
+	{
+		// Position -> triangle adjacency of the current index buffer, for the flip test
+		AdjacencyOffsets.Init(0, NumVertices + 1);
+		for (int32 Index : Indices)
+		{
+			++AdjacencyOffsets[PositionIds[Index] + 1];
+		}
+		for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+		{
+			AdjacencyOffsets[Vertex + 1] += AdjacencyOffsets[Vertex];
+		}
+		Adjacency.SetNumUninitialized(Indices.Num());
+		{
+			TArray<int32> FillCursor(AdjacencyOffsets.GetData(), NumVertices);
+			for (int32 Corner = 0; Corner < Indices.Num(); ++Corner)
+			{
+				Adjacency[FillCursor[PositionIds[Indices[Corner]]]++] = Corner / 3;
+			}
+		}
+
+		VertexEdges.Reset();
+		for (int32 Corner = 0; Corner < Indices.Num(); ++Corner)
+		{
+			VertexEdges.Add(MakeEdgeKey(Indices[Corner], Indices[Corner - Corner % 3 + (Corner + 1) % 3]));
+		}
+
+		Candidates.Reset();
+		for (int32 Corner = 0; Corner < Indices.Num(); ++Corner)
+		{
+			const int32 A = Indices[Corner];
+			const int32 B = Indices[Corner - Corner % 3 + (Corner + 1) % 3];
+			const bool bSeamEdge = !VertexEdges.Contains(MakeEdgeKey(B, A));
+
+			for (int32 Direction = 0; Direction < 2; ++Direction)
+			{
+				const int32 From = Direction == 0 ? A : B;
+				const int32 To = Direction == 0 ? B : A;
+				const EModelSimplifyVertexKind Kind = Kinds[PositionIds[From]];
+				const bool bAllowed =
+					Kind == EModelSimplifyVertexKind::Manifold ||
+					(Kind == EModelSimplifyVertexKind::Seam && bSeamEdge && Kinds[PositionIds[To]] != EModelSimplifyVertexKind::Manifold);
+				if (!bAllowed || PositionIds[From] == PositionIds[To])
+				{
+					continue;
+				}
+
+				FModelQuadric Merged = Quadrics[PositionIds[From]];
+				Merged.Add(Quadrics[PositionIds[To]]);
+				const double Error = Merged.Evaluate(Positions[To]) / FMath::Max(Merged.Weight, UE_DOUBLE_SMALL_NUMBER);
+				if (Error <= MaxError)
+				{
+					Candidates.Add({ From, To, Error });
+				}
+			}
+		}
+
+		if (Candidates.Num() == 0)
+		{
+			break;
+		}
+		Algo::SortBy(Candidates, &FCollapse::Error);
+
+		Remap.SetNumUninitialized(NumVertices);
+		for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+		{
+			Remap[Vertex] = Vertex;
+		}
+		Touched.Init(false, NumVertices);
+
+		const int32 TrianglesToRemove = NumTriangles - TargetTriangles;
+		int32 NumCollapses = 0;
+		for (const FCollapse& Collapse : Candidates)
+		{
+			if (NumCollapses * 2 >= TrianglesToRemove)
+			{
+				break;
+			}
+
+			const int32 FromPosition = PositionIds[Collapse.From];
+			const int32 ToPosition = PositionIds[Collapse.To];
+			if (Touched[FromPosition] || Touched[ToPosition])
+			{
+				continue;
+			}
+
+			// A seam collapse moves both sides: the sibling goes to the target's vertex on its own side of the seam
+			int32 SiblingFrom = INDEX_NONE;
+			int32 SiblingTo = INDEX_NONE;
+			if (Kinds[FromPosition] == EModelSimplifyVertexKind::Seam)
+			{
+				SiblingFrom = NextAtPosition[Collapse.From];
+				for (int32 Candidate = NextAtPosition[Collapse.To]; Candidate != Collapse.To; Candidate = NextAtPosition[Candidate])
+				{
+					if (VertexEdges.Contains(MakeEdgeKey(SiblingFrom, Candidate)) || VertexEdges.Contains(MakeEdgeKey(Candidate, SiblingFrom)))
+					{
+						SiblingTo = Candidate;
+						break;
+					}
+				}
+				if (SiblingTo == INDEX_NONE)
+				{
+					continue;
+				}
+			}
+
+			// Reject collapses that fold a surviving triangle over (or squash it to a sliver)
+			const FVector3d& Target = Positions[Collapse.To];
+			bool bFlips = false;
+			for (int32 Slot = AdjacencyOffsets[FromPosition]; Slot < AdjacencyOffsets[FromPosition + 1] && !bFlips; ++Slot)
+			{
+				const int32* Corners = &Indices[Adjacency[Slot] * 3];
+				FVector3d Before[3], After[3];
+				bool bHasTarget = false;
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					const int32 Position = PositionIds[Corners[Corner]];
+					bHasTarget |= Position == ToPosition;
+					Before[Corner] = Positions[Corners[Corner]];
+					After[Corner] = Position == FromPosition ? Target : Before[Corner];
+				}
+				if (bHasTarget)
+				{
+					continue; // Degenerates and is removed
+				}
+
+				const FVector3d NormalBefore = FVector3d::CrossProduct(Before[1] - Before[0], Before[2] - Before[0]);
+				const FVector3d NormalAfter = FVector3d::CrossProduct(After[1] - After[0], After[2] - After[0]);
+				bFlips = FVector3d::DotProduct(NormalBefore, NormalAfter) <= 0.25 * NormalBefore.Size() * NormalAfter.Size();
+			}
+			if (bFlips)
+			{
+				continue;
+			}
+
+			Remap[Collapse.From] = Collapse.To;
+			if (SiblingFrom != INDEX_NONE)
+			{
+				Remap[SiblingFrom] = SiblingTo;
+			}
+			Quadrics[ToPosition].Add(Quadrics[FromPosition]);
+
+			// The flip test above only sees positions from before this pass, so collapses in one pass have to be independent:
+			// no later collapse may move a vertex that shares a triangle with the one that just moved
+			Touched[ToPosition] = true;
+			for (int32 Slot = AdjacencyOffsets[FromPosition]; Slot < AdjacencyOffsets[FromPosition + 1]; ++Slot)
+			{
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					Touched[PositionIds[Indices[Adjacency[Slot] * 3 + Corner]]] = true;
+				}
+			}
+			++NumCollapses;
+		}
+
+		if (NumCollapses == 0)
+		{
+			break;
+		}
+
+		// --- Apply the pass and drop the triangles that degenerated ---
+		int32 Write = 0;
+		for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+		{
+			const int32 I0 = Remap[Indices[Triangle * 3 + 0]];
+			const int32 I1 = Remap[Indices[Triangle * 3 + 1]];
+			const int32 I2 = Remap[Indices[Triangle * 3 + 2]];
+			const int32 P0 = PositionIds[I0];
+			const int32 P1 = PositionIds[I1];
+			const int32 P2 = PositionIds[I2];
+			if (P0 == P1 || P1 == P2 || P0 == P2)
+			{
+				continue;
+			}
+			Indices[Write++] = I0;
+			Indices[Write++] = I1;
+			Indices[Write++] = I2;
+		}
+		Indices.SetNum(Write, EAllowShrinking::No);
+		NumTriangles = Write / 3;
+	}
+
+	return Indices;
+}
+
+void FModelMeshSimplifier::BuildLODs(FModelMeshData& Mesh, int32 NumLODs, float ReductionRatio)
+{
+	Mesh.LODIndices.Reset();
+	if (NumLODs <= 1 || Mesh.GetNumTriangles() == 0)
+	{
+		return;
+	}
+
+	FBox3f Bounds(ForceInit);
+	for (int32 Vertex = 0; Vertex < Mesh.GetNumVertices(); ++Vertex)
+	{
+		Bounds += Mesh.GetPosition(Vertex);
+	}
+	const float Diagonal = Bounds.GetSize().Size();
+
+	// Each level starts from the previous one, so the chain costs about as much as simplifying LOD0 once
+	TArray<int32> Previous(Mesh.GetIndices().GetData(), Mesh.GetNumIndices());
+	float MaxDeviation = Diagonal * BaseRelativeDeviation;
+	for (int32 LOD = 1; LOD < NumLODs; ++LOD)
+	{
+		const int32 TargetTriangles = FMath::Max(1, FMath::FloorToInt32(Previous.Num() / 3 * ReductionRatio));
+		TArray<int32> Simplified = Simplify(Mesh, Previous, TargetTriangles, MaxDeviation);
+		if (Simplified.Num() == 0 || Simplified.Num() >= Previous.Num())
+		{
+			break;
+		}
+
+		Previous = Simplified;
+		Mesh.LODIndices.Add(MoveTemp(Simplified));
+		MaxDeviation *= 2.f;
+	}
+}
@@ -0,0 +1,23 @@
+// Quadric-error edge-collapse simplification of extracted meshes, used to build LOD chains on the import workers
+#pragma once
+#include "CoreMinimal.h"
+
+struct FModelMeshData;
+
+class FModelMeshSimplifier
+{
+public:
+    // Simplified copy of Indices over the same vertices of Mesh (no vertex is moved or created, edges collapse onto
+    // existing vertices). Border vertices, which include every material boundary since a section is one material,
+    // never move; UV/normal seam vertices only slide along their seam. Stops at TargetTriangles or once the cheapest
+    // collapse would move the surface by more than MaxDeviation
+    static TArray<int32> Simplify(const FModelMeshData& Mesh, TArrayView<const int32> Indices, int32 TargetTriangles, float MaxDeviation);
+
+    // Fills Mesh.LODIndices with up to NumLODs - 1 levels, each keeping ReductionRatio of the previous level's triangles.
+    // The chain ends early when a level cannot be reduced any further
+    static void BuildLODs(FModelMeshData& Mesh, int32 NumLODs, float ReductionRatio);
+
+private:
+    // Allowed deviation of LOD1 as a fraction of the mesh's bounds diagonal, doubled for every further level
+    static constexpr float BaseRelativeDeviation = 0.01f;
+};
@@ -0,0 +1,203 @@
+// Parallel smooth-normal generation with a crease angle for welded meshes, in place of Assimp's GenNormals
+#include "ModelNormalGenerator.h"
+#include "ModelVertexWelder.h"
+#include "ModelImportProfiler.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+
+// Smoothing groups around one vertex: every corner gets the sum of the face normals within the crease angle of its own
+// face, and corners whose sums point the same way share a group (and so an output vertex). At most 256 groups per vertex
+struct FModelVertexSmoothingGroups
+{
+	TArray<FVector3f, TInlineAllocator<8>> Normals;
+
+	void Build(TArrayView<const int32> Corners, const TArray<FVector3f>& FaceNormals, float CosCrease, uint8* OutCornerGroups)
+	{
+		static constexpr float SameNormalDot = 0.9999f;
+		Normals.Reset();
+
+		int32 NumDegenerate = 0;
+		for (int32 i = 0; i < Corners.Num(); ++i)
+		{
+			const FVector3f Own = FaceNormals[Corners[i] / 3].GetSafeNormal();
+			if (Own.IsZero())
+			{
+				++NumDegenerate;
+				continue;
+			}
+
+			FVector3f Sum = FVector3f::ZeroVector;
+			for (int32 Other : Corners)
+			{
+				const FVector3f& OtherNormal = FaceNormals[Other / 3];
+				if (FVector3f::DotProduct(Own, OtherNormal.GetSafeNormal()) >= CosCrease)
+				{
+					Sum += OtherNormal;
+				}
+			}
+			const FVector3f Normal = Sum.GetSafeNormal(UE_SMALL_NUMBER, Own);
+
+			int32 Group = 0;
+			while (Group < Normals.Num() && FVector3f::DotProduct(Normals[Group], Normal) < SameNormalDot)
+			{
+				++Group;
+			}
+			if (Group == Normals.Num())
+			{
+				if (Normals.Num() < 256)
+				{
+					Normals.Add(Normal);
+				}
+				else
+				{
+					Group = Normals.Num() - 1;
+				}
+			}
+			OutCornerGroups[i] = static_cast<uint8>(Group);
+		}
+
+		// Zero-area corners have no direction of their own; they ride along with the first group
+		if (NumDegenerate > 0)
+		{
+			if (Normals.Num() == 0)
+			{
+				Normals.Add(FVector3f::UpVector);
+			}
+			for (int32 i = 0; i < Corners.Num(); ++i)
+			{
+				if (FaceNormals[Corners[i] / 3].GetSafeNormal().IsZero())
+				{
+					OutCornerGroups[i] = 0;
+				}
+			}
+		}
+	}
+};
+
+void FModelNormalGenerator::GenerateNormals(FModelWeldStreams& Streams, float CreaseAngleDegrees)
+{
+	MODEL_IMPORT_SCOPE(GenerateNormals);
+
+	const int32 NumVertices = Streams.Positions.Num();
+	const int32 NumIndices = Streams.Indices.Num();
+	const int32 NumTriangles = NumIndices / 3;
+	const float CosCrease = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(CreaseAngleDegrees, 0.f, 180.f)));
+
+	// --- Area-weighted face normals ---
+	TArray<FVector3f> FaceNormals;
+	FaceNormals.SetNumUninitialized(NumTriangles);
+	ParallelFor(FMath::DivideAndRoundUp(NumTriangles, TrianglesPerChunk), [&](int32 Chunk)
+		{
+			const int32 End = FMath::Min(NumTriangles, (Chunk + 1) * TrianglesPerChunk);
+			for (int32 Triangle = Chunk * TrianglesPerChunk; Triangle < End; ++Triangle)
+			{
+				const FVector3f& P0 = Streams.Positions[Streams.Indices[Triangle * 3 + 0]];
+				const FVector3f& P1 = Streams.Positions[Streams.Indices[Triangle * 3 + 1]];
+				const FVector3f& P2 = Streams.Positions[Streams.Indices[Triangle * 3 + 2]];
+				// Same orientation convention as Assimp's GenNormals on the y/z-swapped positions
+				FaceNormals[Triangle] = FVector3f::CrossProduct(P2 - P0, P1 - P0);
+			}
+		});
+
+	// --- Vertex -> corner adjacency (CSR); slots are filled concurrently, then each vertex's list is sorted for determinism ---
+	TArray<int32> CornerOffsets;
+	CornerOffsets.SetNumZeroed(NumVertices + 1);
+	ParallelFor(FMath::DivideAndRoundUp(NumIndices, TrianglesPerChunk), [&](int32 Chunk)
+		{
+			const int32 End = FMath::Min(NumIndices, (Chunk + 1) * TrianglesPerChunk);
+			for (int32 Corner = Chunk * TrianglesPerChunk; Corner < End; ++Corner)
+			{
+				FPlatformAtomics::InterlockedIncrement(&CornerOffsets[Streams.Indices[Corner] + 1]);
+			}
+		});
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		CornerOffsets[Vertex + 1] += CornerOffsets[Vertex];
+	}
+
+	TArray<int32> Corners;
+	Corners.SetNumUninitialized(NumIndices);
+	{
+		TArray<int32> FillCursor(CornerOffsets.GetData(), NumVertices);
+		ParallelFor(FMath::DivideAndRoundUp(NumIndices, TrianglesPerChunk), [&](int32 Chunk)
+			{
+				const int32 End = FMath::Min(NumIndices, (Chunk + 1) * TrianglesPerChunk);
+				for (int32 Corner = Chunk * TrianglesPerChunk; Corner < End; ++Corner)
+				{
+					Corners[FPlatformAtomics::InterlockedIncrement(&FillCursor[Streams.Indices[Corner]]) - 1] = Corner;
+				}
+			});
+	}
+
+	// --- Pass 1: smoothing groups per vertex; every group past the first becomes an extra vertex ---
+	const int32 NumVertexChunks = FMath::DivideAndRoundUp(NumVertices, VerticesPerChunk);
+	TArray<uint8> CornerGroups;
+	CornerGroups.SetNumUninitialized(NumIndices);
+	TArray<int32> ExtraVertices;
+	ExtraVertices.SetNumUninitialized(NumVertices + 1);
+	ParallelFor(NumVertexChunks, [&](int32 Chunk)
+		{
+			FModelVertexSmoothingGroups Groups;
+			const int32 End = FMath::Min(NumVertices, (Chunk + 1) * VerticesPerChunk);
+			for (int32 Vertex = Chunk * VerticesPerChunk; Vertex < End; ++Vertex)
+			{
+				TArrayView<int32> VertexCorners(Corners.GetData() + CornerOffsets[Vertex], CornerOffsets[Vertex + 1] - CornerOffsets[Vertex]);
+				Algo::Sort(VertexCorners);
+				Groups.Build(VertexCorners, FaceNormals, CosCrease, CornerGroups.GetData() + CornerOffsets[Vertex]);
+				ExtraVertices[Vertex + 1] = FMath::Max(0, Groups.Normals.Num() - 1);
+			}
+		});
+
+	ExtraVertices[0] = 0;
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		ExtraVertices[Vertex + 1] += ExtraVertices[Vertex];
+	}
+	const int32 NumOutputVertices = NumVertices + ExtraVertices[NumVertices];
+
+	// --- Pass 2: rebuild the same groups (cheaper than storing them), write normals, split vertices, retarget corners ---
+	const bool bUVs = Streams.UVs.Num() == NumVertices;
+	Streams.Positions.SetNumUninitialized(NumOutputVertices);
+	Streams.Normals.SetNumUninitialized(NumOutputVertices);
+	if (bUVs)
+	{
+		Streams.UVs.SetNumUninitialized(NumOutputVertices);
+	}
+
+	ParallelFor(NumVertexChunks, [&](int32 Chunk)
+		{
+			FModelVertexSmoothingGroups Groups;
+			const int32 End = FMath::Min(NumVertices, (Chunk + 1) * VerticesPerChunk);
+			for (int32 Vertex = Chunk * VerticesPerChunk; Vertex < End; ++Vertex)
+			{
+				const int32 FirstCorner = CornerOffsets[Vertex];
+				TArrayView<const int32> VertexCorners(Corners.GetData() + FirstCorner, CornerOffsets[Vertex + 1] - FirstCorner);
+				Groups.Build(VertexCorners, FaceNormals, CosCrease, CornerGroups.GetData() + FirstCorner);
+
+				if (Groups.Normals.Num() == 0)
+				{
+					Streams.Normals[Vertex] = FVector3f::UpVector; // Not referenced by any triangle
+					continue;
+				}
+
+				Streams.Normals[Vertex] = Groups.Normals[0];
+				for (int32 Group = 1; Group < Groups.Normals.Num(); ++Group)
+				{
+					const int32 Split = NumVertices + ExtraVertices[Vertex] + Group - 1;
+					Streams.Positions[Split] = Streams.Positions[Vertex];
+					Streams.Normals[Split] = Groups.Normals[Group];
+					if (bUVs) Streams.UVs[Split] = Streams.UVs[Vertex];
+				}
+
+				// Each corner is owned by exactly one vertex, so these writes never overlap between chunks
+				for (int32 i = 0; i < VertexCorners.Num(); ++i)
+				{
+					const int32 Group = CornerGroups[FirstCorner + i];
+					if (Group > 0)
+					{
+						Streams.Indices[VertexCorners[i]] = NumVertices + ExtraVertices[Vertex] + Group - 1;
+					}
+				}
+			}
+		});
+}
@@ -0,0 +1,17 @@
+// Parallel smooth-normal generation with a crease angle for welded meshes, in place of Assimp's GenNormals
+#pragma once
+#include "CoreMinimal.h"
+
+struct FModelWeldStreams;
+
+class FModelNormalGenerator
+{
+public:
+    // Fills Streams.Normals: each corner averages the area-weighted normals of the faces around its vertex that are within
+    // CreaseAngleDegrees of its own face. Vertices whose corners end up with different normals are split along the crease
+    static void GenerateNormals(FModelWeldStreams& Streams, float CreaseAngleDegrees);
+
+private:
+    static constexpr int32 TrianglesPerChunk = 16384;
+    static constexpr int32 VerticesPerChunk = 16384;
+};
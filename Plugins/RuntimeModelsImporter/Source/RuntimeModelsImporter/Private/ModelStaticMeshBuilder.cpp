@@ -0,0 +1,140 @@
+// Builds transient UStaticMesh assets from extracted mesh sections, so spawned models can use instanced and cached static draws
+#include "ModelStaticMeshBuilder.h"
+#include "ModelMeshData.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+
+const FName FModelStaticMeshBuilder::MaterialSlotName(TEXT("Material"));
+
+void FModelStaticMeshBuilder::BuildMeshDescription(const FModelMeshData& Section, FMeshDescription& OutDescription, int32 LODIndex)
+{
+	FStaticMeshAttributes Attributes(OutDescription);
+	Attributes.Register();
+
+	// LODs share the section's vertex buffer, so only the vertices a level still uses are copied, in first-use order
+	const TArrayView<const int32> Indices = Section.GetLODIndices(LODIndex);
+	TArray<int32> VertexRemap;
+	TArray<int32> UsedVertices;
+	VertexRemap.Init(INDEX_NONE, Section.GetNumVertices());
+	UsedVertices.Reserve(Section.GetNumVertices());
+	for (int32 Index : Indices)
+	{
+		if (VertexRemap[Index] == INDEX_NONE)
+		{
+			VertexRemap[Index] = UsedVertices.Add(Index);
+		}
+	}
+
+	const int32 NumVertices = UsedVertices.Num();
+	const int32 NumTriangles = Indices.Num() / 3;
+	const bool bHasNormals = Section.HasStream(EModelMeshStreams::Normals);
+	const bool bHasTangents = Section.HasStream(EModelMeshStreams::Tangents);
+	const bool bHasUVs = Section.HasStream(EModelMeshStreams::UVs);
+
+	OutDescription.ReserveNewVertices(NumVertices);
+	OutDescription.ReserveNewVertexInstances(NumVertices);
+	OutDescription.ReserveNewTriangles(NumTriangles);
+	OutDescription.ReserveNewPolygons(NumTriangles);
+	OutDescription.ReserveNewEdges(NumTriangles * 3);
+
+	const FPolygonGroupID GroupID = OutDescription.CreatePolygonGroup();
+	Attributes.GetPolygonGroupMaterialSlotNames()[GroupID] = MaterialSlotName;
+
+	TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexPositions();
+	TVertexInstanceAttributesRef<FVector3f> Normals = Attributes.GetVertexInstanceNormals();
+	TVertexInstanceAttributesRef<FVector3f> Tangents = Attributes.GetVertexInstanceTangents();
+	TVertexInstanceAttributesRef<float> BinormalSigns = Attributes.GetVertexInstanceBinormalSigns();
+	TVertexInstanceAttributesRef<FVector2f> UVs = Attributes.GetVertexInstanceUVs();
+	UVs.SetNumChannels(1);
+
+	// --- Vertices: sections are already split per attribute, so every vertex is its own single instance ---
+	for (int32 Used = 0; Used < NumVertices; ++Used)
+	{
+		const int32 i = UsedVertices[Used];
+		const FVertexID VertexID = OutDescription.CreateVertex();
+		Positions[VertexID] = Section.GetPosition(i);
+
+		const FVertexInstanceID InstanceID = OutDescription.CreateVertexInstance(VertexID);
+		const FVector3f Normal = bHasNormals ? Section.GetNormal(i) : FVector3f::ZAxisVector;
+		Normals[InstanceID] = Normal;
+		UVs.Set(InstanceID, 0, bHasUVs ? Section.GetUV(i) : FVector2f::ZeroVector);
+
+		if (bHasTangents)
+		{
+			const FModelTangentFrame Frame = Section.GetTangent(i);
+			Tangents[InstanceID] = Frame.Tangent;
+			BinormalSigns[InstanceID] = Frame.BitangentSign;
+		}
+		else
+		{
+			// The fast static mesh build keeps whatever basis it is given, so give it a valid one
+			FVector3f Tangent, Bitangent;
+			Normal.FindBestAxisVectors(Tangent, Bitangent);
+			Tangents[InstanceID] = Tangent;
+			BinormalSigns[InstanceID] = 1.f;
+		}
+	}
+
+	// --- Triangles (degenerates skipped, the mesh description rejects repeated corners) ---
+	for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+	{
+		const FVertexInstanceID Corners[3] =
+		{
+			FVertexInstanceID(VertexRemap[Indices[Triangle * 3 + 0]]),
+			FVertexInstanceID(VertexRemap[Indices[Triangle * 3 + 1]]),
+			FVertexInstanceID(VertexRemap[Indices[Triangle * 3 + 2]])
+		};
+		if (Corners[0] == Corners[1] || Corners[1] == Corners[2] || Corners[0] == Corners[2])
+		{
+			continue;
+		}
+		OutDescription.CreateTriangle(GroupID, Corners);
+	}
+}
+
+static bool BuildRenderData(UStaticMesh* StaticMesh, const TArray<const FMeshDescription*>& Descriptions, TArrayView<const float> ScreenSizes, bool bAllowCpuAccess)
+{
+	check(Descriptions.Num() > 0 && Descriptions.Num() <= MAX_STATIC_MESH_LODS && ScreenSizes.Num() == Descriptions.Num());
+
+	// Fast build: keep our normals and tangents, no mesh reduction or distance field build
+	UStaticMesh::FBuildMeshDescriptionsParams Params;
+	Params.bFastBuild = true;
+	Params.bBuildSimpleCollision = false;
+	Params.bCommitMeshDescription = false;
+	Params.bAllowCpuAccess = bAllowCpuAccess;
+	if (!StaticMesh->BuildFromMeshDescriptions(Descriptions, Params))
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Failed to build static mesh render data"));
+		return false;
+	}
+
+	// Nothing computes screen sizes on this path, every LOD would otherwise switch at the same distance
+	FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+	for (int32 LODIndex = 0; LODIndex < Descriptions.Num(); ++LODIndex)
+	{
+		RenderData->ScreenSize[LODIndex].Default = ScreenSizes[LODIndex];
+	}
+	return true;
+}
+
+UStaticMesh* FModelStaticMeshBuilder::CreateStaticMesh(UObject* Outer, const TArray<const FMeshDescription*>& Descriptions, TArrayView<const float> ScreenSizes, UMaterialInterface* Material, bool bAllowCpuAccess)
+{
+	check(IsInGameThread());
+
+	UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Outer, NAME_None, RF_Transient);
+	StaticMesh->GetStaticMaterials().Add(FStaticMaterial(Material, MaterialSlotName));
+	return BuildRenderData(StaticMesh, Descriptions, ScreenSizes, bAllowCpuAccess) ? StaticMesh : nullptr;
+}
+
+bool FModelStaticMeshBuilder::RebuildStaticMesh(UStaticMesh* StaticMesh, const TArray<const FMeshDescription*>& Descriptions, TArrayView<const float> ScreenSizes, bool bAllowCpuAccess)
+{
+	check(IsInGameThread());
+
+	// Detaches every component drawing the mesh until the context goes out of scope, so none renders the old buffers
+	FStaticMeshComponentRecreateRenderStateContext RecreateRenderStateContext(StaticMesh, false);
+	StaticMesh->ReleaseResources();
+	StaticMesh->ReleaseResourcesFence.Wait();
+	return BuildRenderData(StaticMesh, Descriptions, ScreenSizes, bAllowCpuAccess);
+}
@@ -0,0 +1,27 @@
+// Builds transient UStaticMesh assets from extracted mesh sections, so spawned models can use instanced and cached static draws
+#pragma once
+#include "CoreMinimal.h"
+
+struct FMeshDescription;
+struct FModelMeshData;
+class UMaterialInterface;
+class UStaticMesh;
+
+class FModelStaticMeshBuilder
+{
+public:
+    // Name of the single material slot every built mesh gets
+    static const FName MaterialSlotName;
+
+    // Fills a fresh mesh description with one vertex instance per section vertex used by LODIndex, and one polygon group.
+    // Touches no UObjects, so it can run on a worker thread
+    static void BuildMeshDescription(const FModelMeshData& Section, FMeshDescription& OutDescription, int32 LODIndex = 0);
+
+    // GameThread: transient static mesh with one LOD per description, render data only; collision is set up by the
+    // caller. bAllowCpuAccess keeps the CPU copy complex collision cooks from. ScreenSizes holds one entry per description
+    static UStaticMesh* CreateStaticMesh(UObject* Outer, const TArray<const FMeshDescription*>& Descriptions, TArrayView<const float> ScreenSizes, UMaterialInterface* Material, bool bAllowCpuAccess);
+
+    // GameThread: replaces the render data of a mesh CreateStaticMesh built, e.g. to add the CPU copy once complex collision
+    // is asked for. Components using the mesh have their render state recreated around the rebuild
+    static bool RebuildStaticMesh(UStaticMesh* StaticMesh, const TArray<const FMeshDescription*>& Descriptions, TArrayView<const float> ScreenSizes, bool bAllowCpuAccess);
+};
@@ -0,0 +1,185 @@
+// Tangent frames for extracted meshes: Assimp's own frames when it computed them, otherwise MikkTSpace-style generation in parallel
+#include "ModelTangentGenerator.h"
+#include "ModelMeshData.h"
+#include "ModelVertexStreams.h"
+#include "ModelImportProfiler.h"
+#include "assimp/mesh.h"
+#include "Async/ParallelFor.h"
+
+// Any frame perpendicular to the normal, for vertices whose UVs give no direction
+static FModelTangentFrame MakeFallbackFrame(const FVector3f& Normal)
+{
+	FVector3f AxisX, AxisY;
+	Normal.FindBestAxisVectors(AxisX, AxisY);
+
+	FModelTangentFrame Frame;
+	Frame.Tangent = AxisX;
+	Frame.BitangentSign = 1.f;
+	return Frame;
+}
+
+static FVector3f ProjectOntoPlane(const FVector3f& Vector, const FVector3f& Normal)
+{
+	return (Vector - Normal * FVector3f::DotProduct(Normal, Vector)).GetSafeNormal();
+}
+
+static float GetCornerAngle(const FVector3f& Corner, const FVector3f& A, const FVector3f& B)
+{
+	const FVector3f EdgeA = (A - Corner).GetSafeNormal();
+	const FVector3f EdgeB = (B - Corner).GetSafeNormal();
+	return FMath::Acos(FMath::Clamp(FVector3f::DotProduct(EdgeA, EdgeB), -1.f, 1.f));
+}
+
+void FModelTangentGenerator::BuildTangents(const aiMesh* SourceMesh, FModelMeshData& Mesh)
+{
+	if (!Mesh.HasStream(EModelMeshStreams::Tangents))
+	{
+		return;
+	}
+
+	if (SourceMesh->HasTangentsAndBitangents())
+	{
+		// Assimp already paid for these in CalcTangentSpace; the bitangent is kept as a sign and rebuilt from the normal
+		FModelVertexStreams::ConvertTangentFrames(SourceMesh->mTangents, SourceMesh->mBitangents, Mesh.GetNormals(), Mesh.GetTangents());
+		return;
+	}
+
+	GenerateTangents(Mesh);
+}
+
+void FModelTangentGenerator::GenerateTangents(FModelMeshData& Mesh)
+{
+	MODEL_IMPORT_SCOPE(ExtractTangents);
+	check(!Mesh.IsQuantized());
+
+	TArrayView<FModelTangentFrame> Frames = Mesh.GetTangents();
+	const TArrayView<const FVector3f> Positions = Mesh.GetPositions();
+	const TArrayView<const FVector2f> UVs = Mesh.GetUVs();
+	const TArrayView<const int32> Indices = Mesh.GetIndices();
+	const int32 NumVertices = Mesh.GetNumVertices();
+	const int32 NumTriangles = Mesh.GetNumTriangles();
+	const int32 NumCorners = NumTriangles * 3;
+
+	if (Frames.Num() == 0)
+	{
+		return;
+	}
+
+	// Normal the renderer will use for each vertex (up when the mesh has no normal stream)
+	auto GetNormal = [&Mesh](int32 Vertex) { return Mesh.GetNormal(Vertex); };
+
+	if (UVs.Num() == 0 || NumTriangles == 0)
+	{
+		ParallelFor(FMath::DivideAndRoundUp(NumVertices, VerticesPerChunk), [&](int32 Chunk)
+			{
+				const int32 Last = FMath::Min((Chunk + 1) * VerticesPerChunk, NumVertices);
+				for (int32 Vertex = Chunk * VerticesPerChunk; Vertex < Last; ++Vertex)
+				{
+					Frames[Vertex] = MakeFallbackFrame(GetNormal(Vertex));
+				}
+			});
+		return;
+	}
+
+	// --- Per-corner contributions; every corner belongs to one triangle, so chunks never write the same slot ---
+	TArray<FVector3f> CornerTangents;
+	TArray<FVector3f> CornerBitangents;
+	CornerTangents.SetNumUninitialized(NumCorners);
+	CornerBitangents.SetNumUninitialized(NumCorners);
+
+	ParallelFor(FMath::DivideAndRoundUp(NumTriangles, TrianglesPerChunk), [&](int32 Chunk)
+		{
+			const int32 Last = FMath::Min((Chunk + 1) * TrianglesPerChunk, NumTriangles);
+			for (int32 Triangle = Chunk * TrianglesPerChunk; Triangle < Last; ++Triangle)
+			{
+				const int32 Corner0 = Triangle * 3;
+				const int32 Vertex[3] = { Indices[Corner0], Indices[Corner0 + 1], Indices[Corner0 + 2] };
+
+				const FVector3f& P0 = Positions[Vertex[0]];
+				const FVector3f& P1 = Positions[Vertex[1]];
+				const FVector3f& P2 = Positions[Vertex[2]];
+				const FVector2f& UV0 = UVs[Vertex[0]];
+				const FVector2f& UV1 = UVs[Vertex[1]];
+				const FVector2f& UV2 = UVs[Vertex[2]];
+
+				const FVector3f Edge1 = P1 - P0;
+				const FVector3f Edge2 = P2 - P0;
+				const FVector2f DeltaUV1 = UV1 - UV0;
+				const FVector2f DeltaUV2 = UV2 - UV0;
+				const float Determinant = DeltaUV1.X * DeltaUV2.Y - DeltaUV2.X * DeltaUV1.Y;
+
+				// Degenerate UV mapping contributes nothing; its vertices take their frame from neighbors or the fallback
+				FVector3f FaceTangent = FVector3f::ZeroVector;
+				FVector3f FaceBitangent = FVector3f::ZeroVector;
+				if (FMath::Abs(Determinant) > UE_SMALL_NUMBER)
+				{
+					const float InvDeterminant = 1.f / Determinant;
+					FaceTangent = (Edge1 * DeltaUV2.Y - Edge2 * DeltaUV1.Y) * InvDeterminant;
+					FaceBitangent = (Edge2 * DeltaUV1.X - Edge1 * DeltaUV2.X) * InvDeterminant;
+				}
+
+				const float Angles[3] =
+				{
+					GetCornerAngle(P0, P1, P2),
+					GetCornerAngle(P1, P2, P0),
+					GetCornerAngle(P2, P0, P1)
+				};
+
+				for (int32 k = 0; k < 3; ++k)
+				{
+					const FVector3f Normal = GetNormal(Vertex[k]);
+					CornerTangents[Corner0 + k] = ProjectOntoPlane(FaceTangent, Normal) * Angles[k];
+					CornerBitangents[Corner0 + k] = ProjectOntoPlane(FaceBitangent, Normal) * Angles[k];
+				}
+			}
+		});
+
+	// --- Vertex -> corners table (counting sort over the index buffer) ---
+	TArray<int32> CornerOffsets;
+	CornerOffsets.SetNumZeroed(NumVertices + 1);
+	for (int32 Corner = 0; Corner < NumCorners; ++Corner)
+	{
+		++CornerOffsets[Indices[Corner] + 1];
+	}
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		CornerOffsets[Vertex + 1] += CornerOffsets[Vertex];
+	}
+
+	TArray<int32> VertexCorners;
+	VertexCorners.SetNumUninitialized(NumCorners);
+	{
+		TArray<int32> Cursor(CornerOffsets.GetData(), NumVertices);
+		for (int32 Corner = 0; Corner < NumCorners; ++Corner)
+		{
+			VertexCorners[Cursor[Indices[Corner]]++] = Corner;
+		}
+	}
+
+	// --- Per-vertex sum and Gram-Schmidt, parallel over vertices (each vertex only reads its own corners) ---
+	ParallelFor(FMath::DivideAndRoundUp(NumVertices, VerticesPerChunk), [&](int32 Chunk)
+		{
+			const int32 Last = FMath::Min((Chunk + 1) * VerticesPerChunk, NumVertices);
+			for (int32 Vertex = Chunk * VerticesPerChunk; Vertex < Last; ++Vertex)
+			{
+				FVector3f TangentSum = FVector3f::ZeroVector;
+				FVector3f BitangentSum = FVector3f::ZeroVector;
+				for (int32 i = CornerOffsets[Vertex]; i < CornerOffsets[Vertex + 1]; ++i)
+				{
+					TangentSum += CornerTangents[VertexCorners[i]];
+					BitangentSum += CornerBitangents[VertexCorners[i]];
+				}
+
+				const FVector3f Normal = GetNormal(Vertex);
+				const FVector3f Tangent = ProjectOntoPlane(TangentSum, Normal);
+				if (Tangent.IsNearlyZero())
+				{
+					Frames[Vertex] = MakeFallbackFrame(Normal);
+					continue;
+				}
+
+				Frames[Vertex].Tangent = Tangent;
+				Frames[Vertex].BitangentSign = FVector3f::DotProduct(FVector3f::CrossProduct(Normal, Tangent), BitangentSum) < 0.f ? -1.f : 1.f;
+			}
+		});
+}
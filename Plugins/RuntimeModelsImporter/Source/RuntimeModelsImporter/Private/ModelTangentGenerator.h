@@ -0,0 +1,22 @@
+// Tangent frames for extracted meshes: Assimp's own frames when it computed them, otherwise MikkTSpace-style generation in parallel
+#pragma once
+#include "CoreMinimal.h"
+
+struct aiMesh;
+struct FModelMeshData;
+
+class FModelTangentGenerator
+{
+public:
+    // Fills Mesh's tangent stream (no-op when it has none): copied from SourceMesh when Assimp has tangents and
+    // bitangents (aiProcess_CalcTangentSpace), generated otherwise. Mesh must still be in the float format
+    static void BuildTangents(const aiMesh* SourceMesh, FModelMeshData& Mesh);
+
+    // MikkTSpace per-corner math: face tangent/bitangent from the UV gradients, projected onto each vertex's normal plane,
+    // weighted by the corner angle, summed per vertex and orthonormalized. Runs in parallel chunks over the index buffer
+    static void GenerateTangents(FModelMeshData& Mesh);
+
+private:
+    static constexpr int32 TrianglesPerChunk = 8192;
+    static constexpr int32 VerticesPerChunk = 16384;
+};
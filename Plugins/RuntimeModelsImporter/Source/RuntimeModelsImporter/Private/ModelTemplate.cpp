@@ -0,0 +1,254 @@
+// Model template: the static meshes of one import placed any number of times, as actors or as shared instanced components
+#include "ModelTemplate.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+FModelTemplate::FModelTemplate(UWorld* InWorld, TArray<FPart>&& InParts, int32 InPromoteCount, bool bInHierarchical, const FString& InName,
+	TFunction<void(UStaticMeshComponent*)> InSetupComponent)
+	: World(InWorld)
+	, Parts(MoveTemp(InParts))
+	, PromoteCount(InPromoteCount)
+	, bHierarchical(bInHierarchical)
+	, Name(InName)
+	, SetupComponent(MoveTemp(InSetupComponent))
+{
+}
+
+void FModelTemplate::AddInstances(TArrayView<const FTransform> Transforms, TArray<int32>& OutIds)
+{
+	if (!World.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ World of model template '%s' is gone"), *Name);
+		return;
+	}
+
+	if (!bPromoted && Instances.Num() + Transforms.Num() >= PromoteCount)
+	{
+		Promote();
+	}
+
+	if (!bPromoted)
+	{
+		for (const FTransform& Transform : Transforms)
+		{
+			FInstance Instance;
+			Instance.Transform = Transform;
+			Instance.Actor = SpawnInstanceActor(Transform);
+			OutIds.Add(Instances.Add(MoveTemp(Instance)));
+		}
+		return;
+	}
+
+	const int32 FirstSlot = SlotToId.Num();
+	for (const FTransform& Transform : Transforms)
+	{
+		FInstance Instance;
+		Instance.Transform = Transform;
+		Instance.Slot = SlotToId.Num();
+		const int32 Id = Instances.Add(MoveTemp(Instance));
+		SlotToId.Add(Id);
+		OutIds.Add(Id);
+	}
+	AppendSlots(FirstSlot);
+}
+
+bool FModelTemplate::SetInstanceTransform(int32 Id, const FTransform& Transform)
+{
+	if (!Instances.IsValidIndex(Id))
+	{
+		return false;
+	}
+
+	FInstance& Instance = Instances[Id];
+	Instance.Transform = Transform;
+	if (bPromoted)
+	{
+		WriteSlot(Instance.Slot, Transform);
+	}
+	else if (AActor* Actor = Instance.Actor.Get())
+	{
+		Actor->SetActorTransform(Transform);
+	}
+	return true;
+}
+
+bool FModelTemplate::RemoveInstance(int32 Id)
+{
+	if (!Instances.IsValidIndex(Id))
+	{
+		return false;
+	}
+
+	const FInstance Removed = Instances[Id];
+	Instances.RemoveAt(Id);
+	if (!bPromoted)
+	{
+		if (AActor* Actor = Removed.Actor.Get())
+		{
+			Actor->Destroy();
+		}
+		return true;
+	}
+
+	// The last slot moves into the hole, so only that instance is rewritten and the components just drop their tail
+	const int32 LastSlot = SlotToId.Num() - 1;
+	if (Removed.Slot != LastSlot)
+	{
+		const int32 MovedId = SlotToId[LastSlot];
+		Instances[MovedId].Slot = Removed.Slot;
+		SlotToId[Removed.Slot] = MovedId;
+		WriteSlot(Removed.Slot, Instances[MovedId].Transform);
+	}
+	SlotToId.Pop();
+
+	for (int32 PartIndex = 0; PartIndex < Parts.Num(); ++PartIndex)
+	{
+		if (UInstancedStaticMeshComponent* Component = PartComponents[PartIndex].Get())
+		{
+			const int32 NumTransforms = Parts[PartIndex].ModelTransforms.Num();
+			for (int32 Index = (LastSlot + 1) * NumTransforms - 1; Index >= LastSlot * NumTransforms; --Index)
+			{
+				Component->RemoveInstance(Index);
+			}
+		}
+	}
+	return true;
+}
+
+AActor* FModelTemplate::SpawnInstanceActor(const FTransform& Transform) const
+{
+	AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), Transform);
+	if (!Actor)
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Failed to spawn instance of model template '%s'"), *Name);
+		return nullptr;
+	}
+
+#if WITH_EDITOR
+	Actor->SetActorLabel(Name);
+#endif
+
+	USceneComponent* RootComp = NewObject<USceneComponent>(Actor);
+	RootComp->RegisterComponent();
+	Actor->SetRootComponent(RootComp);
+	Actor->SetActorTransform(Transform);
+
+	// Every component draws one of the template's meshes, so vertex and index buffers are shared rather than uploaded again
+	for (const FPart& Part : Parts)
+	{
+		for (const FTransform& ModelTransform : Part.ModelTransforms)
+		{
+			UStaticMeshComponent* MeshComp = NewObject<UStaticMeshComponent>(Actor);
+			MeshComp->SetStaticMesh(Part.StaticMesh);
+			MeshComp->SetupAttachment(RootComp);
+			MeshComp->SetRelativeTransform(ModelTransform);
+			if (SetupComponent)
+			{
+				SetupComponent(MeshComp);
+			}
+			Actor->AddInstanceComponent(MeshComp);
+			MeshComp->RegisterComponent();
+		}
+	}
+	return Actor;
+}
+
+void FModelTemplate::Promote()
+{
+	AActor* Host = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity);
+	if (!Host)
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Failed to spawn instance host of model template '%s', staying on actors"), *Name);
+		PromoteCount = MAX_int32;
+		return;
+	}
+
+#if WITH_EDITOR
+	Host->SetActorLabel(Name + TEXT("_Instances"));
+#endif
+
+	USceneComponent* RootComp = NewObject<USceneComponent>(Host);
+	RootComp->RegisterComponent();
+	Host->SetRootComponent(RootComp);
+	HostActor = Host;
+
+	for (const FPart& Part : Parts)
+	{
+		UInstancedStaticMeshComponent* Component = bHierarchical
+			? NewObject<UHierarchicalInstancedStaticMeshComponent>(Host)
+			: NewObject<UInstancedStaticMeshComponent>(Host);
+		Component->SetStaticMesh(Part.StaticMesh);
+		Component->SetMobility(EComponentMobility::Movable);
+		Component->SetupAttachment(RootComp);
+		if (SetupComponent)
+		{
+			SetupComponent(Component);
+		}
+		Host->AddInstanceComponent(Component);
+		Component->RegisterComponent();
+		PartComponents.Add(Component);
+	}
+
+	// Instances placed so far trade their actors for the first slots
+	for (TSparseArray<FInstance>::TIterator It = Instances.CreateIterator(); It; ++It)
+	{
+		if (AActor* Actor = It->Actor.Get())
+		{
+			Actor->Destroy();
+		}
+		It->Actor.Reset();
+		It->Slot = SlotToId.Num();
+		SlotToId.Add(It.GetIndex());
+	}
+	bPromoted = true;
+	AppendSlots(0);
+
+	UE_LOG(LogTemp, Log, TEXT("🔹 Model template '%s' moved to %d instanced components at %d instances"), *Name, Parts.Num(), PromoteCount);
+}
+
+void FModelTemplate::AppendSlots(int32 FirstSlot)
+{
+	for (int32 PartIndex = 0; PartIndex < Parts.Num(); ++PartIndex)
+	{
+		UInstancedStaticMeshComponent* Component = PartComponents[PartIndex].Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		const FPart& Part = Parts[PartIndex];
+		TArray<FTransform> Transforms;
+		Transforms.Reserve((SlotToId.Num() - FirstSlot) * Part.ModelTransforms.Num());
+		for (int32 Slot = FirstSlot; Slot < SlotToId.Num(); ++Slot)
+		{
+			const FTransform& InstanceTransform = Instances[SlotToId[Slot]].Transform;
+			for (const FTransform& ModelTransform : Part.ModelTransforms)
+			{
+				Transforms.Add(ModelTransform * InstanceTransform);
+			}
+		}
+
+		// Batched so the HISM builds its cluster tree once rather than per instance
+		Component->AddInstances(Transforms, false, true);
+	}
+}
+
+void FModelTemplate::WriteSlot(int32 Slot, const FTransform& Transform)
+{
+	for (int32 PartIndex = 0; PartIndex < Parts.Num(); ++PartIndex)
+	{
+		UInstancedStaticMeshComponent* Component = PartComponents[PartIndex].Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		const TArray<FTransform>& ModelTransforms = Parts[PartIndex].ModelTransforms;
+		for (int32 i = 0; i < ModelTransforms.Num(); ++i)
+		{
+			Component->UpdateInstanceTransform(Slot * ModelTransforms.Num() + i, ModelTransforms[i] * Transform, true, true, true);
+		}
+	}
+}
@@ -0,0 +1,62 @@
+// Model template: the static meshes of one import placed any number of times, as actors or as shared instanced components
+#pragma once
+#include "CoreMinimal.h"
+
+class AActor;
+class UWorld;
+class UStaticMesh;
+class UStaticMeshComponent;
+class UInstancedStaticMeshComponent;
+
+class FModelTemplate
+{
+public:
+    // One static mesh of the model and every model-space transform it is drawn at (one per node referencing the section)
+    struct FPart
+    {
+        UStaticMesh* StaticMesh = nullptr; // Kept alive by the importer's BuiltStaticMeshes
+        TArray<FTransform> ModelTransforms;
+    };
+
+    // Below PromoteCount instances each one is its own actor of UStaticMeshComponents; from then on every instance,
+    // the earlier ones included, lives in one ISM (or HISM) per part on a single host actor. SetupComponent runs on every
+    // mesh component before it registers (collision)
+    FModelTemplate(UWorld* InWorld, TArray<FPart>&& InParts, int32 InPromoteCount, bool bInHierarchical, const FString& InName,
+        TFunction<void(UStaticMeshComponent*)> InSetupComponent = nullptr);
+
+    // Ids stay valid when the template promotes (a removed id may be handed out again); placed actors and
+    // components outlive the template
+    void AddInstances(TArrayView<const FTransform> Transforms, TArray<int32>& OutIds);
+    bool SetInstanceTransform(int32 Id, const FTransform& Transform);
+    bool RemoveInstance(int32 Id);
+    bool IsValidInstance(int32 Id) const { return Instances.IsValidIndex(Id); }
+    int32 GetNumInstances() const { return Instances.Num(); }
+    bool IsPromoted() const { return bPromoted; }
+    UWorld* GetWorld() const { return World.Get(); }
+
+private:
+    struct FInstance
+    {
+        FTransform Transform;
+        TWeakObjectPtr<AActor> Actor;   // Before promotion
+        int32 Slot = INDEX_NONE;        // After promotion: slot i owns ISM indices [i * N, (i + 1) * N) of a part with N transforms
+    };
+
+    AActor* SpawnInstanceActor(const FTransform& Transform) const;
+    void Promote();
+    void AppendSlots(int32 FirstSlot);                          // Adds slots FirstSlot.. to every part component in one batch
+    void WriteSlot(int32 Slot, const FTransform& Transform);   // Rewrites the ISM instances of one slot
+
+    TWeakObjectPtr<UWorld> World;
+    TArray<FPart> Parts;
+    int32 PromoteCount;
+    bool bHierarchical;
+    FString Name;
+    TFunction<void(UStaticMeshComponent*)> SetupComponent;
+
+    TSparseArray<FInstance> Instances;
+    bool bPromoted = false;
+    TWeakObjectPtr<AActor> HostActor;
+    TArray<TWeakObjectPtr<UInstancedStaticMeshComponent>> PartComponents; // Indexed like Parts
+    TArray<int32> SlotToId;
+};
@@ -0,0 +1,128 @@
+// Worker-thread decoding of material textures into BGRA8 mips, so the GameThread only creates and uploads the UTexture2D
+#include "ModelTextureDecoder.h"
+#include "AssimpRuntime3DModelsImporter.h"
+#include "AssimpMappedIOSystem.h"
+#include "IImageWrapperModule.h"
+#include "IImageWrapper.h"
+#include "Modules/ModuleManager.h"
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include "DirectXTex.h"
+#include "Windows/HideWindowsPlatformTypes.h"
+#endif
+
+void FModelTextureDecoder::LoadModules()
+{
+	check(IsInGameThread());
+	FModuleManager::LoadModuleChecked<IImageWrapperModule>("ImageWrapper");
+}
+
+bool FModelTextureDecoder::Decode(const FModelTextureSlot& Slot, FModelDecodedTexture& OutTexture)
+{
+	if (Slot.EmbeddedData.Num() > 0)
+	{
+		// mHeight == 0: compressed blob, otherwise EmbeddedWidth * EmbeddedHeight BGRA texels
+		if (Slot.EmbeddedHeight == 0)
+		{
+			return DecodeImage(Slot.EmbeddedData.GetData(), Slot.EmbeddedData.Num(), OutTexture);
+		}
+
+		FModelDecodedTexture::FMip& Mip = OutTexture.Mips.AddDefaulted_GetRef();
+		Mip.SizeX = Slot.EmbeddedWidth;
+		Mip.SizeY = Slot.EmbeddedHeight;
+		Mip.Data.Append(Slot.EmbeddedData.GetData(), static_cast<int64>(Slot.EmbeddedWidth) * Slot.EmbeddedHeight * sizeof(FColor));
+		return true;
+	}
+
+	// Decode straight out of the mapped file instead of copying it into a heap buffer first
+	TSharedPtr<FAssimpMappedFile> FileData = FPaths::FileExists(Slot.ResolvedPath) ? FAssimpMappedFile::Open(Slot.ResolvedPath) : nullptr;
+	if (!FileData.IsValid() || FileData->GetSize() == 0)
+	{
+		return false;
+	}
+
+	if (FPaths::GetExtension(Slot.ResolvedPath).ToLower() == TEXT("dds"))
+	{
+		return DecodeDDS(FileData->GetData(), FileData->GetSize(), Slot.ResolvedPath, OutTexture);
+	}
+	return DecodeImage(FileData->GetData(), FileData->GetSize(), OutTexture);
+}
+
+bool FModelTextureDecoder::DecodeImage(const uint8* Data, int64 Size, FModelDecodedTexture& OutTexture)
+{
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::GetModuleChecked<IImageWrapperModule>("ImageWrapper");
+	const EImageFormat Format = ImageWrapperModule.DetectImageFormat(Data, Size);
+	if (Format == EImageFormat::Invalid) return false;
+
+	TSharedPtr<IImageWrapper> Wrapper = ImageWrapperModule.CreateImageWrapper(Format);
+	if (!Wrapper.IsValid() || !Wrapper->SetCompressed(Data, Size)) return false;
+
+	FModelDecodedTexture::FMip& Mip = OutTexture.Mips.AddDefaulted_GetRef();
+	if (!Wrapper->GetRaw(ERGBFormat::BGRA, 8, Mip.Data)) return false;
+	Mip.SizeX = Wrapper->GetWidth();
+	Mip.SizeY = Wrapper->GetHeight();
+	return true;
+}
+
+bool FModelTextureDecoder::DecodeDDS(const uint8* Data, int64 Size, const FString& DebugName, FModelDecodedTexture& OutTexture)
+{
+#if PLATFORM_WINDOWS
+	DirectX::ScratchImage ScratchImage;
+	HRESULT Hr = DirectX::LoadFromDDSMemory(Data, static_cast<size_t>(Size), DirectX::DDS_FLAGS_NONE, nullptr, ScratchImage);
+	if (FAILED(Hr))
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Failed to load DDS file: %s"), *DebugName);
+		return false;
+	}
+
+	const DirectX::TexMetadata& Meta = ScratchImage.GetMetadata();
+	const DXGI_FORMAT TargetFormat = DXGI_FORMAT_B8G8R8A8_UNORM;
+
+	DirectX::ScratchImage FinalImage;
+	if (DirectX::IsCompressed(Meta.format))
+	{
+		Hr = DirectX::Decompress(ScratchImage.GetImages(), ScratchImage.GetImageCount(), Meta, TargetFormat, FinalImage);
+	}
+	else if (Meta.format != TargetFormat)
+	{
+		Hr = DirectX::Convert(ScratchImage.GetImages(), ScratchImage.GetImageCount(), Meta, TargetFormat, DirectX::TEX_FILTER_DEFAULT, 0.f, FinalImage);
+	}
+	else
+	{
+		FinalImage = std::move(ScratchImage);
+		Hr = S_OK;
+	}
+
+	if (FAILED(Hr))
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Failed to convert DDS to target format: %s"), *DebugName);
+		return false;
+	}
+
+	// Every mip the file carries
+	const uint32 MipLevels = static_cast<uint32>(FinalImage.GetMetadata().mipLevels);
+	for (uint32 MipIndex = 0; MipIndex < MipLevels; ++MipIndex)
+	{
+		const DirectX::Image* MipImage = FinalImage.GetImage(MipIndex, 0, 0);
+		if (!MipImage || !MipImage->pixels)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("⚠️ Skipping invalid mip level %u for texture %s"), MipIndex, *DebugName);
+			continue;
+		}
+
+		FModelDecodedTexture::FMip& Mip = OutTexture.Mips.AddDefaulted_GetRef();
+		Mip.SizeX = static_cast<int32>(MipImage->width);
+		Mip.SizeY = static_cast<int32>(MipImage->height);
+		Mip.Data.Append(MipImage->pixels, static_cast<int64>(MipImage->slicePitch));
+	}
+	return OutTexture.Mips.Num() > 0;
+#else
+	// No DirectXTex here: ImageWrapper's DDS reader takes uncompressed files, top mip only; block compressed ones fail
+	if (!DecodeImage(Data, Size, OutTexture))
+	{
+		UE_LOG(LogTemp, Error, TEXT("❌ Failed to load DDS file (block compressed DDS needs DirectXTex, Windows only): %s"), *DebugName);
+		return false;
+	}
+	return true;
+#endif
+}
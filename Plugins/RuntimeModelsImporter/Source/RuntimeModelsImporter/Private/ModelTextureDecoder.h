@@ -0,0 +1,21 @@
+// Worker-thread decoding of material textures into BGRA8 mips, so the GameThread only creates and uploads the UTexture2D
+#pragma once
+#include "CoreMinimal.h"
+
+struct FModelTextureSlot;
+struct FModelDecodedTexture;
+
+class FModelTextureDecoder
+{
+public:
+    // Loads the modules decoding relies on; GameThread only, before the first Decode
+    static void LoadModules();
+
+    // Embedded textures (compressed blobs or raw texels), DDS files through DirectXTex with their own mip chain (Windows;
+    // elsewhere ImageWrapper, uncompressed DDS only), and every other file format through ImageWrapper. Safe on any thread after LoadModules
+    static bool Decode(const FModelTextureSlot& Slot, FModelDecodedTexture& OutTexture);
+
+private:
+    static bool DecodeImage(const uint8* Data, int64 Size, FModelDecodedTexture& OutTexture);
+    static bool DecodeDDS(const uint8* Data, int64 Size, const FString& DebugName, FModelDecodedTexture& OutTexture);
+};
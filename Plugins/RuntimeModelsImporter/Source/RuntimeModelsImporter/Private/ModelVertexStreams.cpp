@@ -0,0 +1,95 @@
+// Bulk conversion of Assimp vertex/index streams into FModelMeshData streams: pre-sized outputs, no per-vertex branches, SIMD swizzle
+#include "ModelVertexStreams.h"
+#include "assimp/mesh.h"
+#include "Math/VectorRegister.h"
+
+static_assert(sizeof(aiVector3D) == sizeof(FVector3f), "Stream kernels expect single-precision Assimp vectors (no ASSIMP_DOUBLE_PRECISION)");
+
+void FModelVertexStreams::ConvertVectors(const aiVector3D* Vectors, TArrayView<FVector3f> OutVectors)
+{
+	const int32 Num = OutVectors.Num();
+	if (Num == 0)
+	{
+		return;
+	}
+
+	const float* Src = &Vectors[0].x;
+	float* Dst = &OutVectors[0].X;
+
+	// Four vectors (three registers) per iteration: load 12 floats, swizzle y/z in registers, store 12 floats
+	int32 i = 0;
+	for (; i + 4 <= Num; i += 4)
+	{
+		const VectorRegister4Float A = VectorLoad(Src + i * 3 + 0);    // x0 y0 z0 x1
+		const VectorRegister4Float B = VectorLoad(Src + i * 3 + 4);    // y1 z1 x2 y2
+		const VectorRegister4Float C = VectorLoad(Src + i * 3 + 8);    // z2 x3 y3 z3
+
+		// -> x0 z0 y0 x1 | z1 y1 x2 z2 | y2 x3 z3 y3
+		const VectorRegister4Float OutA = VectorSwizzle(A, 0, 2, 1, 3);
+		const VectorRegister4Float X2Z2 = VectorShuffle(B, C, 2, 2, 0, 0);                // x2 x2 z2 z2
+		const VectorRegister4Float OutB = VectorShuffle(B, X2Z2, 1, 0, 0, 2);
+		const VectorRegister4Float Y2X3 = VectorShuffle(B, C, 3, 3, 1, 1);                // y2 y2 x3 x3
+		const VectorRegister4Float OutC = VectorShuffle(Y2X3, C, 0, 2, 3, 2);
+
+		VectorStore(OutA, Dst + i * 3 + 0);
+		VectorStore(OutB, Dst + i * 3 + 4);
+		VectorStore(OutC, Dst + i * 3 + 8);
+	}
+
+	for (; i < Num; ++i)
+	{
+		OutVectors[i] = FVector3f(Vectors[i].x, Vectors[i].z, Vectors[i].y);
+	}
+}
+
+void FModelVertexStreams::ConvertTangentFrames(const aiVector3D* Tangents, const aiVector3D* Bitangents, TArrayView<const FVector3f> Normals, TArrayView<FModelTangentFrame> OutFrames)
+{
+	const int32 Num = OutFrames.Num();
+	const bool bHasNormals = Normals.Num() == Num;
+
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const FVector3f Tangent(Tangents[i].x, Tangents[i].z, Tangents[i].y);
+		const FVector3f Bitangent(Bitangents[i].x, Bitangents[i].z, Bitangents[i].y);
+
+		OutFrames[i].Tangent = Tangent;
+		// Without normals there is nothing to measure against; -1 is what the swizzle gives a right-handed source frame
+		OutFrames[i].BitangentSign = bHasNormals
+			? (FVector3f::DotProduct(FVector3f::CrossProduct(Normals[i], Tangent), Bitangent) < 0.f ? -1.f : 1.f)
+			: -1.f;
+	}
+}
+
+void FModelVertexStreams::ConvertUVs(const aiVector3D* UVs, TArrayView<FVector2f> OutUVs)
+{
+	FVector2f* Dst = OutUVs.GetData();
+	const int32 Num = OutUVs.Num();
+
+	// Plain strided copy, which the compiler vectorizes on its own
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Dst[i].X = UVs[i].x;
+		Dst[i].Y = UVs[i].y;
+	}
+}
+
+int32 FModelVertexStreams::ConvertTriangles(const aiFace* Faces, int32 NumFaces, TArrayView<int32> OutIndices)
+{
+	check(OutIndices.Num() >= NumFaces * 3);
+	int32* Dst = OutIndices.GetData();
+	int32 NumIndices = 0;
+
+	for (int32 i = 0; i < NumFaces; ++i)
+	{
+		const aiFace& Face = Faces[i];
+		if (Face.mNumIndices == 3)
+		{
+			Dst[NumIndices + 0] = static_cast<int32>(Face.mIndices[0]);
+			Dst[NumIndices + 1] = static_cast<int32>(Face.mIndices[1]);
+			Dst[NumIndices + 2] = static_cast<int32>(Face.mIndices[2]);
+			NumIndices += 3;
+		}
+	}
+
+	return NumIndices;
+}
@@ -0,0 +1,21 @@
+// Bulk conversion of Assimp vertex/index streams into FModelMeshData streams: pre-sized outputs, no per-vertex branches, SIMD swizzle
+#pragma once
+#include "CoreMinimal.h"
+#include "assimp/types.h"
+#include "ModelMeshData.h"
+
+struct aiFace;
+
+struct FModelVertexStreams
+{
+    // Assimp (x, y, z) -> Unreal (x, z, y) for positions and direction vectors, one output per input
+    static void ConvertVectors(const aiVector3D* Vectors, TArrayView<FVector3f> OutVectors);
+    // Tangents plus the bitangent sign, taken from the converted (Unreal space) normals and Assimp's bitangents.
+    // The y/z swap mirrors the frame, so a source frame that was right-handed comes out with a negative sign
+    static void ConvertTangentFrames(const aiVector3D* Tangents, const aiVector3D* Bitangents, TArrayView<const FVector3f> Normals, TArrayView<FModelTangentFrame> OutFrames);
+    // First two components of a UV channel, one output per input
+    static void ConvertUVs(const aiVector3D* UVs, TArrayView<FVector2f> OutUVs);
+    // Triangle faces only (points/lines left over from a non-triangulated import are skipped).
+    // OutIndices holds NumFaces * 3 entries; returns how many were written
+    static int32 ConvertTriangles(const aiFace* Faces, int32 NumFaces, TArrayView<int32> OutIndices);
+};
@@ -0,0 +1,238 @@
+// Parallel spatial-hash vertex welding of extracted streams, in place of Assimp's single-threaded JoinIdenticalVertices
+#include "ModelVertexWelder.h"
+#include "ModelImportProfiler.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Sort.h"
+#include "Hash/xxhash.h"
+
+// Float bits with -0 folded into +0, so equal values always hash equally
+static uint32 GetFloatKey(float Value)
+{
+	const float Canonical = Value == 0.f ? 0.f : Value;
+	uint32 Bits;
+	FMemory::Memcpy(&Bits, &Canonical, sizeof(Bits));
+	return Bits;
+}
+
+struct FModelWeldKeyBuilder
+{
+	const FModelWeldStreams& Streams;
+	bool bNormals;
+	bool bUVs;
+	double InvTolerance;
+
+	// Up to 8 words: the grid point (or float bits) of the position, then normal and UV bits
+	int32 BuildKey(int32 Vertex, uint64* OutWords) const
+	{
+		int32 NumWords = 0;
+		const FVector3f& Position = Streams.Positions[Vertex];
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			OutWords[NumWords++] = InvTolerance > 0.0
+				? static_cast<uint64>(FMath::FloorToInt64(Position[Axis] * InvTolerance + 0.5))
+				: GetFloatKey(Position[Axis]);
+		}
+		if (bNormals)
+		{
+			const FVector3f& Normal = Streams.Normals[Vertex];
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				OutWords[NumWords++] = GetFloatKey(Normal[Axis]);
+			}
+		}
+		if (bUVs)
+		{
+			OutWords[NumWords++] = GetFloatKey(Streams.UVs[Vertex].X);
+			OutWords[NumWords++] = GetFloatKey(Streams.UVs[Vertex].Y);
+		}
+		return NumWords;
+	}
+
+	bool Matches(int32 A, int32 B) const
+	{
+		uint64 KeyA[8], KeyB[8];
+		const int32 NumWords = BuildKey(A, KeyA);
+		BuildKey(B, KeyB);
+		return FMemory::Memcmp(KeyA, KeyB, NumWords * sizeof(uint64)) == 0;
+	}
+};
+
+void FModelVertexWelder::Weld(FModelWeldStreams& Streams, float Tolerance)
+{
+	MODEL_IMPORT_SCOPE(WeldVertices);
+
+	const int32 NumVertices = Streams.Positions.Num();
+	if (NumVertices == 0)
+	{
+		return;
+	}
+
+	const FModelWeldKeyBuilder Keys{ Streams, Streams.Normals.Num() == NumVertices, Streams.UVs.Num() == NumVertices,
+		Tolerance > 0.f ? 1.0 / Tolerance : 0.0 };
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumVertices, VerticesPerChunk);
+
+	// --- Hash every vertex key ---
+	TArray<uint64> Hashes;
+	Hashes.SetNumUninitialized(NumVertices);
+	ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 End = FMath::Min(NumVertices, (Chunk + 1) * VerticesPerChunk);
+			for (int32 Vertex = Chunk * VerticesPerChunk; Vertex < End; ++Vertex)
+			{
+				uint64 Words[8];
+				const int32 NumWords = Keys.BuildKey(Vertex, Words);
+				Hashes[Vertex] = FXxHash64::HashBuffer(Words, NumWords * sizeof(uint64)).Hash;
+			}
+		});
+
+	// --- Counting sort into hash buckets: per-chunk histograms, then a stable per-chunk scatter ---
+	const int32 NumBuckets = FMath::Clamp(static_cast<int32>(FMath::RoundUpToPowerOfTwo(NumVertices / 256 + 1)), 1, 1 << 14);
+	TArray<int32> ChunkOffsets;
+	ChunkOffsets.SetNumZeroed(NumChunks * NumBuckets);
+	ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			int32* Counts = &ChunkOffsets[Chunk * NumBuckets];
+			const int32 End = FMath::Min(NumVertices, (Chunk + 1) * VerticesPerChunk);
+			for (int32 Vertex = Chunk * VerticesPerChunk; Vertex < End; ++Vertex)
+			{
+				++Counts[Hashes[Vertex] & (NumBuckets - 1)];
+			}
+		});
+
+	TArray<int32> BucketStarts;
+	BucketStarts.SetNumUninitialized(NumBuckets + 1);
+	int32 Running = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		BucketStarts[Bucket] = Running;
+		for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+		{
+			const int32 Count = ChunkOffsets[Chunk * NumBuckets + Bucket];
+			ChunkOffsets[Chunk * NumBuckets + Bucket] = Running;
+			Running += Count;
+		}
+	}
+	BucketStarts[NumBuckets] = Running;
+
+	TArray<int32> Sorted;
+	Sorted.SetNumUninitialized(NumVertices);
+	ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			int32* Cursors = &ChunkOffsets[Chunk * NumBuckets];
+			const int32 End = FMath::Min(NumVertices, (Chunk + 1) * VerticesPerChunk);
+			for (int32 Vertex = Chunk * VerticesPerChunk; Vertex < End; ++Vertex)
+			{
+				Sorted[Cursors[Hashes[Vertex] & (NumBuckets - 1)]++] = Vertex;
+			}
+		});
+
+	// --- Buckets are independent: find each vertex's representative (lowest index with an equal key) ---
+	TArray<int32> Representatives;
+	Representatives.SetNumUninitialized(NumVertices);
+	ParallelFor(NumBuckets, [&](int32 Bucket)
+		{
+			TArrayView<int32> Slice(Sorted.GetData() + BucketStarts[Bucket], BucketStarts[Bucket + 1] - BucketStarts[Bucket]);
+			Algo::Sort(Slice, [&Hashes](int32 A, int32 B) { return Hashes[A] != Hashes[B] ? Hashes[A] < Hashes[B] : A < B; });
+
+			for (int32 RunStart = 0; RunStart < Slice.Num();)
+			{
+				int32 RunEnd = RunStart + 1;
+				while (RunEnd < Slice.Num() && Hashes[Slice[RunEnd]] == Hashes[Slice[RunStart]])
+				{
+					++RunEnd;
+				}
+
+				// Equal hashes are almost always equal keys; the full compare only separates true collisions
+				for (int32 i = RunStart; i < RunEnd; ++i)
+				{
+					Representatives[Slice[i]] = Slice[i];
+					for (int32 j = RunStart; j < i; ++j)
+					{
+						if (Representatives[Slice[j]] == Slice[j] && Keys.Matches(Slice[j], Slice[i]))
+						{
+							Representatives[Slice[i]] = Slice[j];
+							break;
+						}
+					}
+				}
+				RunStart = RunEnd;
+			}
+		});
+
+	// --- Compact the surviving vertices, keeping their original relative order ---
+	TArray<int32> NewIndices;
+	NewIndices.SetNumUninitialized(NumVertices);
+	int32 NumWelded = 0;
+	for (int32 Vertex = 0; Vertex < NumVertices; ++Vertex)
+	{
+		NewIndices[Vertex] = Representatives[Vertex] == Vertex ? NumWelded++ : INDEX_NONE;
+	}
+	if (NumWelded == NumVertices)
+	{
+		return;
+	}
+
+	FModelWeldStreams Welded;
+	Welded.Positions.SetNumUninitialized(NumWelded);
+	Welded.Normals.SetNumUninitialized(Keys.bNormals ? NumWelded : 0);
+	Welded.UVs.SetNumUninitialized(Keys.bUVs ? NumWelded : 0);
+	ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 End = FMath::Min(NumVertices, (Chunk + 1) * VerticesPerChunk);
+			for (int32 Vertex = Chunk * VerticesPerChunk; Vertex < End; ++Vertex)
+			{
+				const int32 NewIndex = NewIndices[Vertex];
+				if (NewIndex == INDEX_NONE)
+				{
+					continue;
+				}
+				Welded.Positions[NewIndex] = Streams.Positions[Vertex];
+				if (Keys.bNormals) Welded.Normals[NewIndex] = Streams.Normals[Vertex];
+				if (Keys.bUVs) Welded.UVs[NewIndex] = Streams.UVs[Vertex];
+			}
+		});
+
+	// --- Remap triangles, dropping the ones welding collapsed (per-chunk counts, then a parallel write) ---
+	const int32 NumTriangles = Streams.Indices.Num() / 3;
+	const int32 NumTriangleChunks = FMath::DivideAndRoundUp(NumTriangles, VerticesPerChunk);
+	TArray<int32> TriangleChunkStarts;
+	TriangleChunkStarts.SetNumZeroed(NumTriangleChunks + 1);
+	ParallelFor(NumTriangleChunks, [&](int32 Chunk)
+		{
+			const int32 End = FMath::Min(NumTriangles, (Chunk + 1) * VerticesPerChunk);
+			int32 Kept = 0;
+			for (int32 Triangle = Chunk * VerticesPerChunk; Triangle < End; ++Triangle)
+			{
+				int32* Corners = &Streams.Indices[Triangle * 3];
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					Corners[Corner] = NewIndices[Representatives[Corners[Corner]]];
+				}
+				Kept += (Corners[0] != Corners[1] && Corners[1] != Corners[2] && Corners[0] != Corners[2]) ? 1 : 0;
+			}
+			TriangleChunkStarts[Chunk + 1] = Kept;
+		});
+	for (int32 Chunk = 0; Chunk < NumTriangleChunks; ++Chunk)
+	{
+		TriangleChunkStarts[Chunk + 1] += TriangleChunkStarts[Chunk];
+	}
+
+	Welded.Indices.SetNumUninitialized(TriangleChunkStarts[NumTriangleChunks] * 3);
+	ParallelFor(NumTriangleChunks, [&](int32 Chunk)
+		{
+			const int32 End = FMath::Min(NumTriangles, (Chunk + 1) * VerticesPerChunk);
+			int32 Write = TriangleChunkStarts[Chunk] * 3;
+			for (int32 Triangle = Chunk * VerticesPerChunk; Triangle < End; ++Triangle)
+			{
+				const int32* Corners = &Streams.Indices[Triangle * 3];
+				if (Corners[0] != Corners[1] && Corners[1] != Corners[2] && Corners[0] != Corners[2])
+				{
+					Welded.Indices[Write++] = Corners[0];
+					Welded.Indices[Write++] = Corners[1];
+					Welded.Indices[Write++] = Corners[2];
+				}
+			}
+		});
+
+	Streams = MoveTemp(Welded);
+}
@@ -0,0 +1,24 @@
+// Parallel spatial-hash vertex welding of extracted streams, in place of Assimp's single-threaded JoinIdenticalVertices
+#pragma once
+#include "CoreMinimal.h"
+
+// Unindexed or loosely indexed streams between conversion from Assimp and the final FModelMeshData allocation
+struct FModelWeldStreams
+{
+    TArray<FVector3f> Positions;
+    TArray<FVector3f> Normals;      // Empty when the mesh has none (FModelNormalGenerator fills them after welding)
+    TArray<FVector2f> UVs;          // Empty when the mesh has none
+    TArray<int32> Indices;
+};
+
+class FModelVertexWelder
+{
+public:
+    // Merges vertices whose positions land on the same Tolerance grid point (exact match when Tolerance is 0) and whose
+    // normals and UVs are identical, then drops triangles that collapsed. Every pass is parallel within the mesh, so one
+    // huge scan mesh scales with cores just like many small ones; the lowest original index survives, so output is deterministic
+    static void Weld(FModelWeldStreams& Streams, float Tolerance);
+
+private:
+    static constexpr int32 VerticesPerChunk = 65536;
+};
@@ -1,18 +1,27 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "RuntimeModelsImporter.h"
+#include "AssimpImporterPool.h"
+#include "ModelImportProfiler.h"
+#include "ModelGameThreadScheduler.h"
 
 #define LOCTEXT_NAMESPACE "FRuntimeModelsImporterModule"
 
 void FRuntimeModelsImporterModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	FModelGameThreadScheduler::Startup();
 }
 
 void FRuntimeModelsImporterModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	// Idle importers must go while the Assimp DLL is still loaded
+	FAssimpImporterPool::Get().Empty();
+	FModelImportProfiler::Shutdown();
+	FModelGameThreadScheduler::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
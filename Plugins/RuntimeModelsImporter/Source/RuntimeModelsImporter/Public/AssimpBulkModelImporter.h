@@ -0,0 +1,46 @@
+// Imports a whole list of model files with a bounded number of imports in flight, reporting each model as soon as it is ready
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "AssimpRuntime3DModelsImporter.h"
+#include "AssimpBulkModelImporter.generated.h"
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnBulkModelImported, UAssimpRuntime3DModelsImporter* /*Importer*/, bool /*bSuccess*/);
+DECLARE_MULTICAST_DELEGATE(FOnBulkImportFinished);
+
+UCLASS()
+class RUNTIMEMODELSIMPORTER_API UAssimpBulkModelImporter : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    // Queues every file and starts up to InMaxInFlight imports (<= 0 uses one per worker thread).
+    // A new import is started each time one finishes, so OnModelImported fires per model as they complete.
+    void ImportModels(const TArray<FString>& FilePaths, int32 InMaxInFlight = 0, const FModelImportSettings& InDefaultSettings = FModelImportSettings());
+    // Per-model override of the default settings, keyed by model name (file base name)
+    void SetModelImportSettings(const FString& ModelName, const FModelImportSettings& Settings) { ModelSettingsOverrides.Add(ModelName, Settings); }
+    void CancelAll();
+    bool IsFinished() const { return NextFileIndex >= PendingFiles.Num() && NumInFlight == 0; }
+    int32 GetNumCompleted() const { return NumCompleted; }
+    int32 GetNumQueued() const { return PendingFiles.Num(); }
+    const TArray<UAssimpRuntime3DModelsImporter*>& GetImporters() const { return Importers; }
+    // Timing record of every model imported so far, ready for FModelImportTimings::SaveToFile
+    TArray<FModelImportTimings> GetImportTimings() const;
+
+    FOnBulkModelImported OnModelImported;
+    FOnBulkImportFinished OnAllModelsImported;
+
+private:
+    void PumpQueue();
+    void HandleModelImported(UAssimpRuntime3DModelsImporter* Importer, bool bSuccess);
+
+    UPROPERTY()
+    TArray<UAssimpRuntime3DModelsImporter*> Importers;
+    TArray<FString> PendingFiles;
+    FModelImportSettings DefaultSettings;
+    TMap<FString, FModelImportSettings> ModelSettingsOverrides;
+    int32 NextFileIndex = 0;
+    int32 NumInFlight = 0;
+    int32 NumCompleted = 0;
+    int32 MaxInFlight = 1;
+};
@@ -0,0 +1,35 @@
+// Pool of reusable Assimp::Importer instances, so loader registration and postprocess-step setup are paid once per worker instead of once per import
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+namespace Assimp { class Importer; }
+
+// Returns the importer to the pool instead of deleting it
+struct RUNTIMEMODELSIMPORTER_API FAssimpImporterReleaser
+{
+    void operator()(Assimp::Importer* Importer) const;
+};
+
+using FPooledAssimpImporter = TUniquePtr<Assimp::Importer, FAssimpImporterReleaser>;
+
+class RUNTIMEMODELSIMPORTER_API FAssimpImporterPool
+{
+public:
+    static FAssimpImporterPool& Get();
+
+    // Reuses an idle importer when there is one. The importer's scene stays owned by the importer:
+    // scenes are allocated on Assimp's own CRT heap, so they are never orphaned and deleted from our side
+    FPooledAssimpImporter Acquire();
+
+    // Frees the current scene, drops the custom IO and progress handlers and parks the importer for the next import
+    void Release(Assimp::Importer* Importer);
+
+    // Deletes every idle importer (module shutdown)
+    void Empty();
+
+private:
+    FCriticalSection Lock;
+    TArray<Assimp::Importer*> IdleImporters;
+    int32 MaxIdleImporters = 0;
+};
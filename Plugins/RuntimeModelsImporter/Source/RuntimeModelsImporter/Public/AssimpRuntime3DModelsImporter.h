@@ -16,42 +16,138 @@
 #include "Materials/Material.h"
 #include "TextureResource.h"         // For PlatformData
 #include "Rendering/Texture2DResource.h"
+#include "ModelImportSettings.h"
+#include "ModelMeshData.h"
+#include "AssimpImporterPool.h"
+#include "ModelImportTimings.h"
+#include "Async/Future.h"
+#include <atomic>
 #include "AssimpRuntime3DModelsImporter.generated.h"
 struct aiScene;
 struct aiNode;
 struct aiMesh;
 struct aiMaterial;
 struct aiTexture;
+class FAssimpMappedIOSystem;
+class FModelImportProfiler;
+struct FModelSpawnContext;
+class FModelTemplate;
+class UProceduralMeshComponent;
+struct FMeshDescription;
 
-// --- Mesh Section Info
+// --- Node
 USTRUCT()
-struct FModelMeshData
+struct FModelNodeData
 {
     GENERATED_BODY()
 
-    TArray<FVector> Vertices;
-    TArray<int32> Triangles;
-    TArray<FVector> Normals;
-    TArray<FVector2D> UVs;
-    TArray<FVector> Tangents;
-    TArray<FVector> Bitangents;
-    FString MaterialName;
-    UMaterialInterface* Material = nullptr;
+    FString Name;
+    FTransform Transform;
+    TArray<FModelNodeData> Children;
+    TArray<TSharedPtr<FModelMeshData>> MeshSections;  // Shared with every other node that instances the same mesh
+};
 
+// --- Texels decoded on a worker (BGRA8, mip 0 first), waiting for the GameThread to create the UTexture2D
+struct FModelDecodedTexture
+{
+    struct FMip
+    {
+        int32 SizeX = 0;
+        int32 SizeY = 0;
+        TArray64<uint8> Data;
+    };
+    TArray<FMip> Mips;
 };
 
-// --- Node
+// --- A placement made through SpawnInstance(s); stale once the importer commits another import or rebuilds its template
+struct FModelInstanceHandle
+{
+    int32 Id = INDEX_NONE;
+    int32 TemplateSerial = 0;
+
+    bool IsSet() const { return Id != INDEX_NONE; }
+};
+
+// --- Texture reference of a material, resolved on the worker so no aiScene is needed to build the material
 USTRUCT()
-struct FModelNodeData
+struct FModelTextureSlot
+{
+    GENERATED_BODY()
+
+    FName ParamName;
+    int32 TextureType = 0;          // aiTextureType
+    bool bIsColor = false;
+    FString SourcePath;             // As referenced by the material
+    FString ResolvedPath;           // External file on disk, empty for embedded textures
+    TArray<uint8> EmbeddedData;     // Embedded texture bytes (compressed, or raw BGRA texels when EmbeddedHeight > 0)
+    int32 EmbeddedWidth = 0;
+    int32 EmbeddedHeight = 0;
+    TSharedPtr<FModelDecodedTexture> Decoded; // Set by DecodeTextures on the slot that wins its parameter; not cached
+};
+
+// --- Material Info
+USTRUCT()
+struct FModelMaterialData
 {
     GENERATED_BODY()
 
     FString Name;
-    FTransform Transform;
-    TArray<FModelNodeData> Children;
-    TArray<FModelMeshData> MeshSections;
+    bool bHasBaseColor = false;
+    FLinearColor BaseColor = FLinearColor::Black;
+    TArray<FModelTextureSlot> Textures; // In priority order, first slot that loads wins its parameter
+};
+
+// --- Import stages in pipeline order, each owns a slice of the 0..1 progress range
+enum class EModelImportStage : uint8
+{
+    Reading,            // Mapping and hashing the source file
+    LoadingCache,       // Reading extracted data back from the model cache (replaces Parsing..Extracting)
+    Parsing,            // Assimp ReadFile
+    PostProcessing,     // Assimp postprocess steps
+    Extracting,         // ParseNode/ExtractMesh/ExtractMaterial, texture decoding
+    Committing          // GameThread material/texture creation, time-sliced by FModelGameThreadScheduler
+};
+
+RUNTIMEMODELSIMPORTER_API const TCHAR* GetModelImportStageName(EModelImportStage Stage);
+
+// --- In-flight import, shared between the worker stages and the GameThread commit
+struct FModelImportTask : public TSharedFromThis<FModelImportTask>
+{
+    FString FilePath;
+    FPooledAssimpImporter Importer;             // Owns Scene and IOSystem, returns to the pool on reset
+    FAssimpMappedIOSystem* IOSystem = nullptr;  // File I/O stage output, serves every read of this import
+    const aiScene* Scene = nullptr;             // ReadFile stage output
+    FModelImportSettings Settings;
+    uint64 SourceHash = 0;                      // Content hash of the source file, keys the model cache
+    bool bLoadedFromCache = false;
+    TSharedPtr<FModelImportProfiler> Profiler;  // Per-import timing record, current on whichever thread runs a stage
+    double StartTime = 0.0;
+    FModelNodeData RootNode;                    // Parse stage output
+    TArray<FModelMaterialData> Materials;       // Parse stage output, indexed by FModelMeshData::MaterialIndex
+    std::atomic<bool> bCancelled = false;
+    TPromise<bool> Promise;
+
+    // Progress reporting, set up by ImportModel. Called from worker threads, delivered on the GameThread
+    TFunction<void(float /*Progress*/, EModelImportStage)> OnProgress;
+    std::atomic<int32> LastReportedPermille = -1;
+    std::atomic<uint8> LastReportedStage = 0xFF;
+    TArray<TArray<TSharedPtr<FModelMeshData>>> Meshes; // Extract stage output, indexed like Scene->mMeshes: the sections (spatial chunks) of each mesh, empty when unreferenced
+    int32 NumMeshesToExtract = 0;               // Unique meshes referenced by the node tree, for Extracting progress
+    std::atomic<int32> NumMeshesExtracted = 0;
+    TMap<const FModelMeshData*, TSharedPtr<TArray<FMeshDescription>>> MeshDescriptions; // Per LOD, for the sections SpawnModel will build static meshes for
+    TMap<const FModelMeshData*, TArray<FVector>> CollisionHulls; // SimplifiedConvex only: hull points of every referenced section
+    TMap<const FModelMeshData*, TArray<TArray<FVector>>> ConvexDecompositions; // ConvexDecomposition only: from <file>.collision or decomposed here
+
+    bool IsCancelled() const { return bCancelled.load(std::memory_order_relaxed); }
+    // Maps a stage-local 0..1 fraction onto the overall range; throttled to ~1% steps plus every stage change
+    void ReportProgress(EModelImportStage Stage, float StageFraction);
+    void ReleaseScene();
 };
 
+class UAssimpRuntime3DModelsImporter;
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnModelImportCompleted, UAssimpRuntime3DModelsImporter* /*Importer*/, bool /*bSuccess*/);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnModelImportProgress, UAssimpRuntime3DModelsImporter* /*Importer*/, float /*Progress 0..1*/, const FString& /*StageName*/);
+
 
 UCLASS()
 class RUNTIMEMODELSIMPORTER_API UAssimpRuntime3DModelsImporter : public UObject
@@ -60,32 +156,111 @@ class RUNTIMEMODELSIMPORTER_API UAssimpRuntime3DModelsImporter : public UObject
 
 public:
     UAssimpRuntime3DModelsImporter();
+    virtual void BeginDestroy() override;
     void LoadAssimpDLLIfNeeded();
-    void ImportModel(const FString& InFilePath);
+    // Runs file I/O, ReadFile and parsing on worker threads, then commits on the GameThread.
+    // The future (and OnImportCompleted) fire on the GameThread once the model is ready to spawn.
+    TFuture<bool> ImportModel(const FString& InFilePath);
+    TFuture<bool> ImportModel(const FString& InFilePath, const FModelImportSettings& InSettings);
+    void SetImportSettings(const FModelImportSettings& InSettings) { ImportSettings = InSettings; }
+    const FModelImportSettings& GetImportSettings() const { return ImportSettings; }
+    // Stops the current import at the next stage/mesh boundary (or inside ReadFile, through the progress handler)
+    // and frees its scene on the worker. OnImportCompleted does not fire for a cancelled import
+    void CancelImport();
+    bool IsImporting() const { return ActiveImport.IsValid(); }
+    FOnModelImportCompleted OnImportCompleted;
+    FOnModelImportProgress OnImportProgress;
+    // Stage times of the last completed import (plus SpawnModel calls since), see FModelImportTimings::SaveToFile
+    FModelImportTimings GetLastImportTimings() const;
     void SetModelID(const FString& InID) { ModelID = InID; }
     FString GetModelID() const { return ModelID; }
     void SetModelName(const FString& InName) { ModelName = InName; }
     FString GetModelName() const { return ModelName; }
     AActor* SpawnModel(UWorld* World, const FTransform& modelTransform);
+    // Same model, built a node per FModelGameThreadScheduler step so a large hierarchy is spread over frames.
+    // The future fires on the GameThread with the root actor once every node is in (null if the spawn was dropped)
+    TFuture<AActor*> SpawnModelAsync(UWorld* World, const FTransform& modelTransform, EModelWorkPriority Priority = EModelWorkPriority::Normal);
+    // Model template: this import's static meshes and materials built once and shared by every placement, without a
+    // node hierarchy (GetNodeActorByName does not see these). Each placement is its own actor until there are
+    // ImportSettings.TemplatePromoteCount of them; from then on all of them are instances of one ISM/HISM per mesh
+    FModelInstanceHandle SpawnInstance(UWorld* World, const FTransform& InstanceTransform);
+    TArray<FModelInstanceHandle> SpawnInstances(UWorld* World, const TArray<FTransform>& InstanceTransforms);
+    bool SetInstanceTransform(const FModelInstanceHandle& Handle, const FTransform& InstanceTransform);
+    bool RemoveInstance(const FModelInstanceHandle& Handle);
+    int32 GetNumInstances() const;
+    // Switches the collision of a model spawned by this import (its root actor from SpawnModel/SpawnModelAsync) after the fact,
+    // e.g. None at spawn and Complex once the player gets close. Static meshes are shared, so with the static mesh backend
+    // every other placement of the same sections follows; cooking honours ImportSettings.bAsyncCollisionCooking.
+    // ConvexDecomposition is only cheap here when the import already used it; otherwise it decomposes on the GameThread.
+    // Complex rebuilds the render data of static meshes built without ImportSettings.bKeepComplexCollisionData
+    void SetModelCollision(AActor* ModelActor, EModelCollisionMode Mode);
     void ApplyTransform(const FTransform& modelTransform);
-    void DebugAllTexturesInScene(const aiScene* Scene, const FString& InFilePath);
-    FString GetTextureTypeName(aiTextureType Type);
+    static void DebugAllTexturesInScene(const aiScene* Scene, const FString& InFilePath);
+    static FString GetTextureTypeName(aiTextureType Type);
     void HideModel();
-    AActor* GetNodeActorByName(const FString& NodeName) const; // for attaching config
+    AActor* GetNodeActorByName(const FString& NodeName) const; // ActorPerNode hierarchy only
+    USceneComponent* GetNodeComponentByName(const FString& NodeName) const; // Either hierarchy; the node actor's root in ActorPerNode, for attaching config
 private:
     const FModelNodeData& GetRootNode() const { return RootNode; }
-    void ParseNode(aiNode* Node, const aiScene* Scene, FModelNodeData& OutNode, const FString& FbxFilePath);
-    void ExtractMesh(aiMesh* Mesh, const aiScene* Scene, FModelMeshData& OutMesh, const FString& FbxFilePath);
-    void SpawnNodeRecursive(UWorld* World,const FModelNodeData& Node, AActor* Parent);
-    FTransform ConvertAssimpMatrix(const aiMatrix4x4& AssimpMatrix);
+    // Worker-thread stages, must not touch UObjects
+    static bool ReadSourceFile(FModelImportTask& Task);
+    static bool ReadScene(FModelImportTask& Task);
+    static bool LoadCachedSceneData(FModelImportTask& Task);
+    static bool ExtractSceneData(FModelImportTask& Task);
+    static void ExtractMaterial(aiMaterial* AssimpMaterial, const aiScene* Scene, FModelMaterialData& OutMaterial, const FString& FbxFilePath);
+    static void ParseNode(aiNode* Node, const aiScene* Scene, FModelNodeData& OutNode, FModelImportTask& Task);
+    static void CollectReferencedMeshes(const aiNode* Node, TBitArray<>& OutReferenced);
+    static void ExtractMeshes(FModelImportTask& Task);
+    static void ExtractMesh(aiMesh* Mesh, const aiScene* Scene, TArray<TSharedPtr<FModelMeshData>>& OutSections, const FModelImportSettings& Settings);
+    static void ExtractWeldedMesh(const aiMesh* Mesh, FModelMeshData& OutMesh, const FModelImportSettings& Settings);
+    static void FinishMeshSection(const aiMesh* Mesh, FModelMeshData& OutMesh, const FModelImportSettings& Settings);
+    static bool BuildMeshDescriptions(FModelImportTask& Task);
+    static bool DecodeTextures(FModelImportTask& Task);
+    static bool BuildCollisionHulls(FModelImportTask& Task);
+    static bool DecomposeCollision(FModelImportTask& Task);
+    static FTransform ConvertAssimpMatrix(const aiMatrix4x4& AssimpMatrix);
+    // GameThread commit stage
+    bool CommitImport(FModelImportTask& Task);
+    void ScheduleCommit(const TSharedRef<FModelImportTask>& Task);
+    static void FinishImport(const TSharedRef<FModelImportTask>& Task, TWeakObjectPtr<UAssimpRuntime3DModelsImporter> WeakThis, bool bSuccess);
+    static void CollectMaterialIndices(const FModelNodeData& Node, TSet<int32>& OutIndices);
+    void ResolveMaterialsRecursive(FModelNodeData& Node, const TArray<FModelMaterialData>& Materials);
+    static void CountMeshData(const FModelNodeData& Node, FModelImportTimings& Timings, TSet<const FModelMeshData*>& CountedMeshes);
+    AActor* SpawnRootActor(UWorld* World, const FTransform& modelTransform);
+    void InitSpawnContext(FModelSpawnContext& Context) const;
+    void SpawnNodeRecursive(UWorld* World,const FModelNodeData& Node, AActor* Parent, const FTransform& ParentModelTransform, FModelSpawnContext& Context);
+    void SpawnNodeComponentsRecursive(const FModelNodeData& Node, AActor* Owner, USceneComponent* Parent, const FTransform& ParentModelTransform, FModelSpawnContext& Context);
+    // One node each, without recursing; both return the node's component (the node actor's root in ActorPerNode)
+    USceneComponent* SpawnNodeActor(UWorld* World, const FModelNodeData& Node, AActor* Parent, const FTransform& ModelTransform, FModelSpawnContext& Context);
+    USceneComponent* SpawnNodeComponent(const FModelNodeData& Node, AActor* Owner, USceneComponent* Parent, const FTransform& ModelTransform, FModelSpawnContext& Context);
+    void CreateSectionComponents(const FModelNodeData& Node, AActor* Owner, USceneComponent* NodeComponent, const FTransform& ModelTransform, FModelSpawnContext& Context);
+    static void CountSectionReferences(const FModelNodeData& Node, TMap<const FModelMeshData*, int32>& OutCounts);
+    void SpawnInstancedSections(AActor* RootActor, FModelSpawnContext& Context);
+    bool SpawnInstancedSection(AActor* RootActor, const FModelMeshData& Section, const TArray<FTransform>& Transforms);
+    UStaticMesh* GetOrBuildStaticMesh(const FModelMeshData& Section);
+    FModelTemplate* GetOrBuildTemplate(UWorld* World);
+    FModelTemplate* FindTemplate(const FModelInstanceHandle& Handle) const;
+    static void CollectSectionTransforms(const FModelNodeData& Node, const FTransform& ParentModelTransform, TMap<const FModelMeshData*, TArray<FTransform>>& OutTransforms);
+    // Collision. The static mesh's body setup is shared by all its components; a mode requested while it cooks is applied after
+    void SetupStaticMeshCollision(UStaticMesh* StaticMesh, const FModelMeshData& Section, EModelCollisionMode Mode);
+    void SetupComponentCollision(UStaticMeshComponent* Component, EModelCollisionMode Mode); // Before RegisterComponent
+    void OnStaticMeshCollisionCooked(TWeakObjectPtr<UStaticMesh> WeakMesh, bool bSuccess);
+    // Empty Hulls: taken from the component's own vertices (SetModelCollision does not know its section)
+    void ApplyProcMeshCollision(UProceduralMeshComponent* Mesh, EModelCollisionMode Mode, TArrayView<const TArray<FVector>> Hulls);
+    // Built on the worker for their mode, otherwise on first use. GetSectionHulls is empty for modes without hulls
+    const TArray<FVector>& GetCollisionHull(const FModelMeshData& Section);
+    const TArray<TArray<FVector>>& GetConvexDecomposition(const FModelMeshData& Section);
+    TArrayView<const TArray<FVector>> GetSectionHulls(const FModelMeshData& Section, EModelCollisionMode Mode);
     void LoadMasterMaterial();
     bool IsVectorFinite(const FVector& Vec);
     bool IsTransformValid(const FTransform& Transform);
     TMap<FString, AActor*> SpawnedNodeActors;
-    UMaterialInstanceDynamic* CreateMaterialFromAssimp(aiMaterial* AssimpMaterial, const aiScene* Scene, const FString& FbxFilePath);
-    UTexture2D* CreateTextureFromEmbedded(const aiTexture* EmbeddedTex, const FString& DebugName, aiTextureType Type, const FString& MaterialName, const FName& ParamName);
-    UTexture2D* LoadTextureFromDisk(const FString& TexturePath, const FString& MaterialName, const FName& ParamName, aiTextureType Type);
-    UTexture2D* LoadDDSTexture(const FString& DDSTexture, aiTextureType Type);
+    TMap<FString, USceneComponent*> SpawnedNodeComponents;
+    UMaterialInstanceDynamic* CreateMaterialFromData(const FModelMaterialData& MaterialData, int32 MaterialIndex);
+    // Incremental CreateMaterialFromData: the instance on the first call (NextSlot == INDEX_NONE), then one texture per call.
+    // True once the material is complete
+    bool CreateMaterialStep(const FModelMaterialData& MaterialData, int32 MaterialIndex, int32& NextSlot);
+    UTexture2D* CreateTextureFromDecoded(const FModelDecodedTexture& Decoded, aiTextureType Type, const FString& MaterialName, const FName& ParamName);
     UPROPERTY()
     TArray<UMaterialInstanceDynamic*> LoadedMaterials;
     UPROPERTY()
@@ -94,9 +269,28 @@ private:
     FString ModelID = "DefaultModelID";
     FString ModelName = "DefaultModelName";
     FString FilePath;
+    FModelImportSettings ImportSettings;
     FModelNodeData RootNode;
-    TMap<aiMaterial*, UMaterialInstanceDynamic*> MaterialCache;
+    TMap<int32, UMaterialInstanceDynamic*> MaterialCache; // By material index of the current import
+    UPROPERTY()
+    TArray<UStaticMesh*> BuiltStaticMeshes;
+    TMap<const FModelMeshData*, UStaticMesh*> StaticMeshCache; // Shared between SpawnModel calls, reset by each import
+    TMap<const FModelMeshData*, TSharedPtr<TArray<FMeshDescription>>> PendingMeshDescriptions; // Built on the worker, consumed by GetOrBuildStaticMesh
+    TSharedPtr<FModelTemplate> Template; // Built by the first SpawnInstance(s) after a commit, for one world
+    TMap<const FModelMeshData*, TArray<FVector>> CollisionHulls;
+    TMap<const FModelMeshData*, TArray<TArray<FVector>>> ConvexDecompositions;
+    TMap<UStaticMesh*, const FModelMeshData*> StaticMeshSections; // Reverse of StaticMeshCache, for SetModelCollision
+    TSet<UStaticMesh*> CpuAccessibleMeshes; // Keep the CPU copy triangle collision cooks from; others are rebuilt when Complex is asked for
+    struct FPendingCollisionCook
+    {
+        TArray<TWeakObjectPtr<UPrimitiveComponent>> Components; // Registered before the cook landed, their bodies are recreated after
+        TOptional<EModelCollisionMode> NextMode;                // Requested through SetModelCollision while this cook ran
+    };
+    TMap<TWeakObjectPtr<UStaticMesh>, FPendingCollisionCook> CookingStaticMeshes; // Survives commits: components of earlier imports still wait
+    int32 TemplateSerial = 0;
 
-    const aiScene* TempScene;
+    TSharedPtr<FModelImportTask> ActiveImport;
+    int32 CommitSerial = 0; // Bumped by every commit; an async spawn still walking the previous RootNode stops
+    TSharedPtr<FModelImportProfiler> LastImportProfiler;
 };
 
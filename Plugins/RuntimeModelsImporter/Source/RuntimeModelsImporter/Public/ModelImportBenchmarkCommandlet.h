@@ -0,0 +1,19 @@
+// Headless import benchmark: imports every model of a corpus folder through the runtime importer and writes throughput and stage times as JSON
+#pragma once
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ModelImportBenchmarkCommandlet.generated.h"
+
+// <Editor-Cmd> <Project>.uproject -run=ModelImportBenchmark -Corpus=<folder> -nullrhi -unattended
+//     [-Output=<results.json>] [-Csv=<stages.csv>] [-Preset=FastPreview|Balanced|ShippingQuality]
+//     [-MaxInFlight=<n>] [-NoCache] [-AssimpProfile] [-Timeout=<seconds>]
+// Returns non-zero when any model fails to import or the run times out, so CI can gate on it.
+UCLASS()
+class RUNTIMEMODELSIMPORTER_API UModelImportBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UModelImportBenchmarkCommandlet();
+    virtual int32 Main(const FString& Params) override;
+};
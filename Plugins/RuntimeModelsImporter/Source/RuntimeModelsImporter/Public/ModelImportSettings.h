@@ -0,0 +1,116 @@
+// Import presets and per-model import settings: which Assimp postprocess steps run and how ExtractMesh builds the mesh streams
+#pragma once
+#include "CoreMinimal.h"
+#include "ModelImportSettings.generated.h"
+
+UENUM()
+enum class EModelImportPreset : uint8
+{
+    FastPreview,        // Triangulate + flat normals, no welding, no tangents. For quick looks at big files
+    Balanced,           // Assimp JoinIdenticalVertices/GenNormals/CalcTangentSpace plus vertex-cache order, without overdraw ordering or OptimizeMeshes
+    ShippingQuality,    // Full postprocess chain plus vertex-cache, overdraw and fetch ordering
+    Custom              // Settings were edited by hand after picking a preset
+};
+
+UENUM()
+enum class EModelSpawnBackend : uint8
+{
+    ProceduralMesh,     // One UProceduralMeshComponent per section (dynamic draw path, the original spawn behavior)
+    StaticMesh          // Transient UStaticMesh per section on UStaticMeshComponents (cached static draws)
+};
+
+UENUM()
+enum class EModelSpawnHierarchy : uint8
+{
+    ActorPerNode,       // An AActor per node under the model's root actor (the original spawn behavior)
+    ComponentPerNode    // One actor for the whole model, a USceneComponent per node, registered in one batch
+};
+
+UENUM()
+enum class EModelCollisionMode : uint8
+{
+    None,               // No collision; the cheapest spawn, for decorative models
+    BoundingBox,        // One box per section
+    SimplifiedConvex,   // One convex hull per section, from its extreme points (FModelCollisionBuilder)
+    ConvexDecomposition, // Up to MaxConvexHulls hulls per section (FModelConvexDecomposer), kept in <file>.collision; for models that simulate
+    Complex             // Every triangle, complex-as-simple (the original spawn behavior)
+};
+
+UENUM()
+enum class EModelWorkPriority : uint8
+{
+    High,               // Drained first, e.g. models right around the camera
+    Normal,
+    Low                 // Only runs in frames where nothing more urgent is waiting
+};
+
+USTRUCT()
+struct RUNTIMEMODELSIMPORTER_API FModelImportSettings
+{
+    GENERATED_BODY()
+
+    EModelImportPreset Preset = EModelImportPreset::ShippingQuality;
+
+    // --- Assimp ReadFile
+    uint32 PostProcessFlags = 0;        // See GetReadFileFlags for what actually reaches ReadFile
+
+    // --- ExtractMesh
+    bool bParallelWeldAndNormals = false; // Opt-in, no preset sets it: FModelVertexWelder/FModelNormalGenerator/FModelTangentGenerator per mesh replace JoinIdenticalVertices/GenNormals/CalcTangentSpace
+    float WeldTolerance = 0.f;          // Grid spacing positions snap to when welding; 0 = exact match only
+    float NormalCreaseAngle = 60.f;     // Degrees; faces meeting at a sharper angle get split normals
+    bool bRecomputeNormals = false;     // Ignore normals from the file (e.g. STL facet normals) and always generate smooth ones
+    int32 SpatialChunkVertices = 0;     // Meshes above this many vertices are split into spatial chunks of about this size, each its own section/component and bounds; 0 = never
+    bool bImportUVs = true;
+    bool bComputeTangents = true;       // Build a tangent stream for every mesh section
+    bool bOptimizeVertexCache = true;   // Tipsify triangle order and first-use vertex order (FModelMeshOptimizer)
+    bool bOptimizeOverdraw = true;      // With bOptimizeVertexCache, also sort triangle clusters outside-in
+    int32 NumLODs = 1;                  // 1 = source mesh only; up to MAX_STATIC_MESH_LODS quadric-simplified levels
+    float LODReductionRatio = 0.5f;     // Triangles each LOD keeps of the previous one
+    bool bQuantizeVertices = false;     // Octahedral normals/tangents and half UVs (FModelMeshData::Quantize)
+    bool bQuantizePositions = false;    // With bQuantizeVertices, 16-bit positions inside the mesh bounds
+
+    // --- SpawnModel (not part of the cache key)
+    EModelSpawnBackend SpawnBackend = EModelSpawnBackend::ProceduralMesh;
+    EModelSpawnHierarchy SpawnHierarchy = EModelSpawnHierarchy::ActorPerNode;
+    bool bInstanceRepeatedMeshes = true;    // Meshes referenced by MinInstanceCount or more nodes render through one instanced component
+    int32 MinInstanceCount = 2;
+    bool bUseHierarchicalInstancing = true; // HISM (per-cluster culling) rather than a plain ISM for those components
+    EModelCollisionMode CollisionMode = EModelCollisionMode::Complex;
+    bool bAsyncCollisionCooking = true;     // Cook collision off the GameThread; sections have none until their cook lands
+    bool bKeepComplexCollisionData = false; // Build static meshes with the CPU copy Complex cooks from, so a later SetModelCollision(Complex) needs no rebuild
+    int32 MaxConvexHulls = 16;              // ConvexDecomposition: hull budget per section
+    int32 DecompositionResolution = 32;     // ConvexDecomposition: voxels along a section's longest axis
+    float DecompositionConcavity = 0.02f;   // ConvexDecomposition: a part whose hull overshoots it by less than this fraction of the section's volume is not split
+    TArray<float> LODScreenSizes;           // Screen size of LOD1, LOD2...; missing entries follow from LODReductionRatio
+    bool bPrepareModelTemplate = false;     // Build every section's mesh description on the worker, as SpawnInstance(s) needs static meshes for all of them
+    int32 TemplatePromoteCount = 16;        // A model template moves its placements into one ISM/HISM per mesh once it has this many
+
+    // --- GameThread commit (not part of the cache key)
+    bool bTimeSliceCommit = true;       // Materials and textures are created through FModelGameThreadScheduler under its frame budget (ModelImport.GameThreadBudgetMs)
+    EModelWorkPriority CommitPriority = EModelWorkPriority::Normal;
+
+    // --- Diagnostics (not part of the cache key)
+    bool bUseModelCache = true;         // Read and write the on-disk model cache; off forces a cold import
+    bool bCaptureAssimpProfile = false; // Record Assimp's per-step Profiler output in the import timings
+
+    FModelImportSettings() { ApplyPreset(EModelImportPreset::ShippingQuality); }
+
+    static FModelImportSettings FromPreset(EModelImportPreset InPreset);
+    static bool ParsePreset(const FString& PresetName, EModelImportPreset& OutPreset);
+    static bool ParseSpawnBackend(const FString& BackendName, EModelSpawnBackend& OutBackend);
+    static bool ParseSpawnHierarchy(const FString& HierarchyName, EModelSpawnHierarchy& OutHierarchy);
+    static bool ParseCollisionMode(const FString& ModeName, EModelCollisionMode& OutMode);
+    void ApplyPreset(EModelImportPreset InPreset);
+
+    // LOD0 is always 1; static mesh backend and instanced sections only, procedural meshes have no LODs
+    float GetLODScreenSize(int32 LODIndex) const;
+
+    // PostProcessFlags minus the steps our own parallel extraction replaces
+    uint32 GetReadFileFlags() const;
+
+    // Everything that changes the extracted data, used to key the on-disk model cache
+    uint64 GetCacheKey() const;
+
+    // GetCacheKey plus the decomposition settings, used to key the persisted convex decomposition
+    uint64 GetCollisionKey() const;
+};
@@ -0,0 +1,40 @@
+// Per-import timing record (stage times, model size counters, Assimp profiler output) with JSON/CSV export
+#pragma once
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+struct FModelImportStageTiming
+{
+    FString Name;
+    double Seconds = 0.0;   // Inclusive, summed over every call
+    int32 Calls = 0;
+};
+
+struct RUNTIMEMODELSIMPORTER_API FModelImportTimings
+{
+    FString FilePath;
+    bool bSuccess = false;
+    bool bLoadedFromCache = false;
+    double TotalSeconds = 0.0;      // ImportModel call to completion, including time queued on the GameThread
+    int64 SourceBytes = 0;
+    int32 NumMeshSections = 0;      // Node references
+    int32 NumUniqueMeshes = 0;      // Distinct meshes; vertex and triangle counts cover these once each
+    int32 NumVertices = 0;
+    int32 NumTriangles = 0;
+    int32 NumMaterials = 0;
+    TArray<FModelImportStageTiming> Stages;     // In first-seen order
+    TArray<FString> AssimpProfilerLines;        // Raw Assimp Profiler output, when FModelImportSettings::bCaptureAssimpProfile is set
+
+    void AddStage(const FString& Name, double Seconds);
+    double GetStageSeconds(const FString& Name) const;
+
+    // { "File": ..., "Stages": { "ReadFile": { "Seconds": .., "Calls": .. } }, "AssimpProfiler": [...] }
+    TSharedRef<FJsonObject> ToJsonObject() const;
+    // Array of ToJsonObject, one per import
+    static FString ToJson(const TArray<FModelImportTimings>& Timings);
+    // One row per import and stage: File,Success,FromCache,Stage,Seconds,Calls (plus a TOTAL row per import)
+    static FString ToCsv(const TArray<FModelImportTimings>& Timings);
+    // Format picked from the extension (.csv, anything else is JSON)
+    static bool SaveToFile(const TArray<FModelImportTimings>& Timings, const FString& Path);
+};
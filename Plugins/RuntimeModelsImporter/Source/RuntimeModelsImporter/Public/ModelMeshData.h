@@ -0,0 +1,176 @@
+// Compact mesh section storage: vertex streams and indices packed into one allocation per mesh, optionally quantized
+#pragma once
+#include "CoreMinimal.h"
+#include "Math/Vector2DHalf.h"
+#include "Misc/EnumClassFlags.h"
+#include "ModelMeshData.generated.h"
+
+class UMaterialInterface;
+
+// Optional vertex streams; positions and indices are always present
+enum class EModelMeshStreams : uint8
+{
+    None        = 0,
+    Normals     = 1 << 0,
+    Tangents    = 1 << 1,
+    UVs         = 1 << 2,
+};
+ENUM_CLASS_FLAGS(EModelMeshStreams);
+
+// Storage format of the vertex streams
+enum class EModelVertexFormat : uint8
+{
+    Float,      // FVector3f positions/normals, FModelTangentFrame tangents, FVector2f UVs (44-48 bytes per vertex)
+    Quantized,  // Octahedral normals, octahedral tangents with a sign bit, half UVs (12 bytes per vertex + positions)
+};
+
+// Tangent plus the bitangent sign: Bitangent = Cross(Normal, Tangent) * BitangentSign (engine convention)
+struct FModelTangentFrame
+{
+    FVector3f Tangent = FVector3f::ForwardVector;
+    float BitangentSign = 1.f;
+};
+
+// Position quantized to 16 bits per axis inside the mesh bounds
+struct FModelPackedPosition
+{
+    uint16 X = 0;
+    uint16 Y = 0;
+    uint16 Z = 0;
+};
+
+// --- Octahedral unit vector encoding, two 16-bit snorm components in one uint32
+struct FModelVertexQuantization
+{
+    static uint32 EncodeUnitVector(const FVector3f& Vector)
+    {
+        const float L1 = FMath::Abs(Vector.X) + FMath::Abs(Vector.Y) + FMath::Abs(Vector.Z);
+        float X = L1 > 0.f ? Vector.X / L1 : 0.f;
+        float Y = L1 > 0.f ? Vector.Y / L1 : 0.f;
+        if (Vector.Z < 0.f)
+        {
+            const float FoldedX = (1.f - FMath::Abs(Y)) * (X >= 0.f ? 1.f : -1.f);
+            const float FoldedY = (1.f - FMath::Abs(X)) * (Y >= 0.f ? 1.f : -1.f);
+            X = FoldedX;
+            Y = FoldedY;
+        }
+        const int16 PackedX = static_cast<int16>(FMath::RoundToInt(FMath::Clamp(X, -1.f, 1.f) * 32767.f));
+        const int16 PackedY = static_cast<int16>(FMath::RoundToInt(FMath::Clamp(Y, -1.f, 1.f) * 32767.f));
+        return static_cast<uint16>(PackedX) | (static_cast<uint32>(static_cast<uint16>(PackedY)) << 16);
+    }
+
+    static FVector3f DecodeUnitVector(uint32 Packed)
+    {
+        const float X = static_cast<int16>(Packed & 0xFFFF) / 32767.f;
+        const float Y = static_cast<int16>(Packed >> 16) / 32767.f;
+        FVector3f Vector(X, Y, 1.f - FMath::Abs(X) - FMath::Abs(Y));
+        const float Fold = FMath::Max(-Vector.Z, 0.f);
+        Vector.X += Vector.X >= 0.f ? -Fold : Fold;
+        Vector.Y += Vector.Y >= 0.f ? -Fold : Fold;
+        return Vector.GetSafeNormal(UE_SMALL_NUMBER, FVector3f::UpVector);
+    }
+
+    // The bitangent sign lives in the lowest bit of the first component, which costs it one bit of precision
+    static uint32 EncodeTangentFrame(const FModelTangentFrame& Frame)
+    {
+        return (EncodeUnitVector(Frame.Tangent) & ~1u) | (Frame.BitangentSign < 0.f ? 1u : 0u);
+    }
+
+    static FModelTangentFrame DecodeTangentFrame(uint32 Packed)
+    {
+        FModelTangentFrame Frame;
+        Frame.Tangent = DecodeUnitVector(Packed & ~1u);
+        Frame.BitangentSign = (Packed & 1u) ? -1.f : 1.f;
+        return Frame;
+    }
+};
+
+// --- Mesh Section Info
+// Layout of the buffer: [Positions][Normals][Tangents][UVs][Indices], absent streams take no space.
+// Float streams use the engine's vertex buffer formats, so they can be handed to mesh building as-is.
+USTRUCT()
+struct RUNTIMEMODELSIMPORTER_API FModelMeshData
+{
+    GENERATED_BODY()
+
+    FString MaterialName;
+    int32 MaterialIndex = INDEX_NONE; // Resolved to Material on the GameThread commit
+    UMaterialInterface* Material = nullptr;
+    // Simplified index buffers over the same vertices, LOD1 first (LOD0 is GetIndices()), see FModelMeshSimplifier
+    TArray<TArray<int32>> LODIndices;
+
+    // Sizes the buffer for float streams (contents uninitialized), dropping any previous data
+    void Allocate(int32 InNumVertices, int32 InNumIndices, EModelMeshStreams InStreams);
+    // Trims the index count after Allocate (faces skipped during conversion), never grows it
+    void ShrinkIndices(int32 InNumIndices);
+    void Reset();
+    // Re-encodes float streams into the quantized format, positions relative to the mesh bounds when bPositions is set.
+    // Meant as the last step of extraction: the typed float views are unavailable afterwards, the Get*(Index) decoders still work
+    void Quantize(bool bPositions);
+
+    int32 GetNumVertices() const { return NumVertices; }
+    int32 GetNumIndices() const { return NumIndices; }
+    int32 GetNumTriangles() const { return NumIndices / 3; }
+    int32 GetNumLODs() const { return 1 + LODIndices.Num(); }
+    TArrayView<const int32> GetLODIndices(int32 LODIndex) const { return LODIndex == 0 ? GetIndices() : TArrayView<const int32>(LODIndices[LODIndex - 1]); }
+    EModelMeshStreams GetStreams() const { return Streams; }
+    bool HasStream(EModelMeshStreams Stream) const { return EnumHasAllFlags(Streams, Stream); }
+    EModelVertexFormat GetVertexFormat() const { return VertexFormat; }
+    bool IsQuantized() const { return VertexFormat == EModelVertexFormat::Quantized; }
+    bool HasQuantizedPositions() const { return bQuantizedPositions; }
+    SIZE_T GetAllocatedSize() const { return Buffer.GetAllocatedSize(); }
+
+    // Float format views, empty for absent streams
+    TArrayView<FVector3f> GetPositions() { check(!bQuantizedPositions); return GetStream<FVector3f>(PositionsOffset, NumVertices); }
+    TArrayView<FVector3f> GetNormals() { check(!IsQuantized()); return GetStream<FVector3f>(NormalsOffset, GetStreamNum(EModelMeshStreams::Normals)); }
+    TArrayView<FModelTangentFrame> GetTangents() { check(!IsQuantized()); return GetStream<FModelTangentFrame>(TangentsOffset, GetStreamNum(EModelMeshStreams::Tangents)); }
+    TArrayView<FVector2f> GetUVs() { check(!IsQuantized()); return GetStream<FVector2f>(UVsOffset, GetStreamNum(EModelMeshStreams::UVs)); }
+    TArrayView<int32> GetIndices() { return GetStream<int32>(IndicesOffset, NumIndices); }
+
+    TArrayView<const FVector3f> GetPositions() const { return const_cast<FModelMeshData*>(this)->GetPositions(); }
+    TArrayView<const FVector3f> GetNormals() const { return const_cast<FModelMeshData*>(this)->GetNormals(); }
+    TArrayView<const FModelTangentFrame> GetTangents() const { return const_cast<FModelMeshData*>(this)->GetTangents(); }
+    TArrayView<const FVector2f> GetUVs() const { return const_cast<FModelMeshData*>(this)->GetUVs(); }
+    TArrayView<const int32> GetIndices() const { return const_cast<FModelMeshData*>(this)->GetIndices(); }
+
+    // Per-vertex reads that decode whichever format the mesh is in
+    FVector3f GetPosition(int32 Index) const;
+    FVector3f GetNormal(int32 Index) const;
+    FModelTangentFrame GetTangent(int32 Index) const;
+    FVector2f GetUV(int32 Index) const;
+
+    // Buffer and counts only; the caller serializes the material fields
+    void SerializeStreams(FArchive& Ar);
+
+private:
+    void UpdateOffsets();
+    int32 GetStreamNum(EModelMeshStreams Stream) const { return HasStream(Stream) ? NumVertices : 0; }
+
+    template <typename T>
+    TArrayView<T> GetStream(int64 Offset, int32 Num)
+    {
+        return Num > 0 ? TArrayView<T>(reinterpret_cast<T*>(Buffer.GetData() + Offset), Num) : TArrayView<T>();
+    }
+
+    template <typename T>
+    const T& GetElement(int64 Offset, int32 Index) const
+    {
+        checkSlow(Index >= 0 && Index < NumVertices);
+        return reinterpret_cast<const T*>(Buffer.GetData() + Offset)[Index];
+    }
+
+    TArray64<uint8> Buffer;
+    int32 NumVertices = 0;
+    int32 NumIndices = 0;
+    int32 IndexCapacity = 0;
+    EModelMeshStreams Streams = EModelMeshStreams::None;
+    EModelVertexFormat VertexFormat = EModelVertexFormat::Float;
+    bool bQuantizedPositions = false;
+    FVector3f PositionMin = FVector3f::ZeroVector;      // Dequantization: PositionMin + Packed * PositionScale
+    FVector3f PositionScale = FVector3f::ZeroVector;
+    int64 PositionsOffset = 0;
+    int64 NormalsOffset = 0;
+    int64 TangentsOffset = 0;
+    int64 UVsOffset = 0;
+    int64 IndicesOffset = 0;
+};
@@ -17,6 +17,8 @@ public class RuntimeModelsImporter : ModuleRules
             "StaticMeshDescription", "ImageWrapper"
         });
 
+        PrivateDependencyModuleNames.AddRange(new string[] { "Json", "TraceLog" });
+
         string PluginRoot = Path.GetFullPath(Path.Combine(ModuleDirectory, "..", ".."));
 
         // ✅ Path to Assimp inside plugin folder
@@ -25,28 +27,45 @@ public class RuntimeModelsImporter : ModuleRules
         // ✅ Include Assimp headers
         PublicIncludePaths.Add(Path.Combine(AssimpPath, "include"));
 
-        // ✅ Link Assimp static lib
-        PublicAdditionalLibraries.Add(Path.Combine(AssimpPath, "lib", "assimp-vc143-mt.lib"));
+        if (Target.Platform == UnrealTargetPlatform.Win64)
+        {
+            // ✅ Link Assimp static lib
+            PublicAdditionalLibraries.Add(Path.Combine(AssimpPath, "lib", "assimp-vc143-mt.lib"));
 
-        // ✅ Delay-load Assimp DLL
-        PublicDelayLoadDLLs.Add("assimp-vc143-mt.dll");
+            // ✅ Delay-load Assimp DLL
+            PublicDelayLoadDLLs.Add("assimp-vc143-mt.dll");
 
-        // ✅ RuntimeDependencies for packaged build
-        string DLLPath = Path.Combine(AssimpPath, "bin", "assimp-vc143-mt.dll");
-        if (File.Exists(DLLPath))
-        {
-            RuntimeDependencies.Add("$(PluginDir)/Binaries/Win64/assimp-vc143-mt.dll", DLLPath);
+            // ✅ RuntimeDependencies for packaged build
+            string DLLPath = Path.Combine(AssimpPath, "bin", "assimp-vc143-mt.dll");
+            if (File.Exists(DLLPath))
+            {
+                RuntimeDependencies.Add("$(PluginDir)/Binaries/Win64/assimp-vc143-mt.dll", DLLPath);
+            }
+            else
+            {
+                System.Console.WriteLine("❌ Assimp DLL missing: " + DLLPath);
+            }
+
+            // ✅ DirectXTex decodes DDS textures (block compressed ones included) on Windows only
+            PublicIncludePaths.Add(Path.Combine(PluginRoot, "ThirdParty/DirectXTex/Include"));
+            PublicAdditionalLibraries.Add(Path.Combine(PluginRoot, "ThirdParty/DirectXTex/Lib/Win64/DirectXTex.lib"));
         }
-        else
+        else if (Target.Platform == UnrealTargetPlatform.Linux)
         {
-            System.Console.WriteLine("❌ Assimp DLL missing: " + DLLPath);
+            // ✅ Assimp shared lib, built with the engine's clang toolchain and libc++ (headless build agents, -nullrhi)
+            string SOPath = Path.Combine(AssimpPath, "lib", "Linux", "libassimp.so");
+            if (File.Exists(SOPath))
+            {
+                PublicAdditionalLibraries.Add(SOPath);
+                RuntimeDependencies.Add("$(PluginDir)/Binaries/Linux/libassimp.so", SOPath);
+            }
+            else
+            {
+                System.Console.WriteLine("❌ Assimp shared lib missing: " + SOPath);
+            }
         }
 
         // ✅ Enable RTTI (Assimp uses dynamic_cast etc.)
         bUseRTTI = true;
-
-        PublicIncludePaths.Add(Path.Combine(PluginRoot, "ThirdParty/DirectXTex/Include"));
-        PublicAdditionalLibraries.Add(Path.Combine(PluginRoot, "ThirdParty/DirectXTex/Lib/Win64/DirectXTex.lib"));
-
     }
 }
\ No newline at end of file
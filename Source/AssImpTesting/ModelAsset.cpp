@@ -40,33 +40,57 @@ void AModelAsset::BeginPlay()
     for (const FString& FilePath : FoundModelFiles)
     {
         UE_LOG(LogTemp, Display, TEXT("✅ Found model: %s"), *FilePath);
-        Initialize3DModel(FilePath);
     }
 
-    for (UAssimpRuntime3DModelsImporter* Model : Loaded3DModels)
+    // Import everything concurrently; each model is spawned as soon as its own import finishes
+    BulkImporter = NewObject<UAssimpBulkModelImporter>(this);
+    BulkImporter->OnModelImported.AddUObject(this, &AModelAsset::OnModelImported);
+    FModelImportSettings DefaultSettings = FModelImportSettings::FromPreset(ImportPreset);
+    DefaultSettings.SpawnBackend = SpawnBackend;
+    DefaultSettings.SpawnHierarchy = SpawnHierarchy;
+    DefaultSettings.SpatialChunkVertices = SpatialChunkVertices;
+    DefaultSettings.CollisionMode = CollisionMode;
+    DefaultSettings.bPrepareModelTemplate = bPlaceAsTemplateInstances;
+    ConfigManager->ApplyImportSettings(BulkImporter, DefaultSettings);
+    BulkImporter->ImportModels(FoundModelFiles, MaxConcurrentImports, DefaultSettings);
+}
+
+void AModelAsset::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Stop any imports still running on worker threads; their results are no longer wanted
+    if (BulkImporter)
     {
-       // FVector location = FVector(100, 100, 100);    
-        FVector location = FVector(336890.000000, -438060.000000, -30100.000000);
-        FRotator rotation = FRotator(0, 0, 0);                    
-        FVector scale = FVector(1, 1, 1);                         
-        FTransform modelTransform = FTransform(rotation, location, scale);
-        Model->SpawnModel(GetWorld(), modelTransform);
-         modelTransform = FTransform(rotation, FVector(100, 100, 100), scale);
-        Model->SpawnModel(GetWorld(), modelTransform);
-       // Model->HideModel(); 
+        BulkImporter->OnModelImported.RemoveAll(this);
+        BulkImporter->CancelAll();
     }
+
+    Super::EndPlay(EndPlayReason);
 }
 
-void AModelAsset::Initialize3DModel(FString Path)
+void AModelAsset::OnModelImported(UAssimpRuntime3DModelsImporter* Model, bool bSuccess)
 {
-    UAssimpRuntime3DModelsImporter* Model = NewObject<UAssimpRuntime3DModelsImporter>(this);
-    if (Model)
+    if (!bSuccess || !Model)
+    {
+        return;
+    }
+
+    // FVector location = FVector(100, 100, 100);
+    FVector location = FVector(336890.000000, -438060.000000, -30100.000000);
+    FRotator rotation = FRotator(0, 0, 0);
+    FVector scale = FVector(1, 1, 1);
+    FTransform modelTransform = FTransform(rotation, location, scale);
+    if (bPlaceAsTemplateInstances)
     {
-        Model->LoadAssimpDLLIfNeeded();
-        Model->ImportModel(Path);
-        Model->SetModelName(ExtractModelNameFromPath(Path));
-        Loaded3DModels.Add(Model);
+        // Both placements share one set of meshes and materials rather than each building its own
+        Model->SpawnInstances(GetWorld(), { modelTransform, FTransform(rotation, FVector(100, 100, 100), scale) });
+        return;
     }
+
+    // Bulk imports finish close together; the async spawn keeps their node hierarchies from landing in one frame
+    Model->SpawnModelAsync(GetWorld(), modelTransform);
+    modelTransform = FTransform(rotation, FVector(100, 100, 100), scale);
+    Model->SpawnModelAsync(GetWorld(), modelTransform);
+    // Model->HideModel();
 }
 
 
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "AssimpRuntime3DModelsImporter.h"
+#include "AssimpBulkModelImporter.h"
 #include "ModelsConfigManager.h"
 #include "ModelAsset.generated.h"
 
@@ -18,10 +19,18 @@ public:
 	AModelAsset();
 	FString ModelsFolderpath = "C:/Users/ebaad.hanif/Desktop/FBX Models";
 	FString ModelsConfigFilepath = FPaths::ProjectContentDir() / TEXT("Archive/ModelsConfig.json");
+	int32 MaxConcurrentImports = 0; // 0 = one import per worker thread
+	EModelImportPreset ImportPreset = EModelImportPreset::ShippingQuality; // Per-model overrides come from ModelsConfig.json
+	EModelSpawnBackend SpawnBackend = EModelSpawnBackend::ProceduralMesh;
+	EModelSpawnHierarchy SpawnHierarchy = EModelSpawnHierarchy::ActorPerNode; // ComponentPerNode for deep CAD assemblies
+	EModelCollisionMode CollisionMode = EModelCollisionMode::None; // Decorative by default; ModelsConfig.json turns it on per model
+	int32 SpatialChunkVertices = 0; // Split terrain/city-sized meshes into culled chunks above this vertex count; 0 = off
+	bool bPlaceAsTemplateInstances = false; // Place each model through its model template (shared meshes, ISM past the promote count). Skips SpawnModelAsync, so no node actors, spawn backend/hierarchy, per-model collision or config attachments
 
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:	
 	// Called every frame
@@ -29,10 +38,10 @@ public:
 private:
 	// CRITICAL FIX: Ensure GC doesn't remove these!
 	UPROPERTY()
-	TArray<UAssimpRuntime3DModelsImporter*> Loaded3DModels;
+	UAssimpBulkModelImporter* BulkImporter = nullptr;
 	UPROPERTY()
 	UModelsConfigManager* ConfigManager;
 	FString ExtractModelNameFromPath(const FString& Path);
-	void Initialize3DModel(FString Path);
+	void OnModelImported(UAssimpRuntime3DModelsImporter* Model, bool bSuccess);
 	TMap<FString, AActor*> AllEntities;
 };
@@ -34,6 +34,12 @@ void UModelsConfigManager::LoadConfig(FString FilePath)
         FModelAttachmentConfig Config;
         ModelObj->TryGetStringField("ModelName", Config.ModelName);
         ModelObj->TryGetStringField("ModelID", Config.ModelID);
+        ModelObj->TryGetStringField("ImportPreset", Config.ImportPreset);
+        ModelObj->TryGetBoolField("ParallelWeldAndNormals", Config.bParallelWeldAndNormals);
+        ModelObj->TryGetStringField("SpawnBackend", Config.SpawnBackend);
+        ModelObj->TryGetStringField("SpawnHierarchy", Config.SpawnHierarchy);
+        ModelObj->TryGetStringField("CollisionMode", Config.CollisionMode);
+        ModelObj->TryGetNumberField("MaxConvexHulls", Config.MaxConvexHulls);
 
         const TArray<TSharedPtr<FJsonValue>>* Attachments;
         if (ModelObj->TryGetArrayField("Attachments", Attachments))
@@ -73,14 +79,15 @@ void UModelsConfigManager::AttachConfigToModel(UAssimpRuntime3DModelsImporter* L
 
             for (const FAttachmentConfig& Attachment : Config.Attachments)
             {
-                AActor* NodeActor = Loader->GetNodeActorByName(Attachment.NodeName);
-                if (!NodeActor)
+                // Node components exist in both spawn hierarchies, node actors only in ActorPerNode
+                USceneComponent* NodeComponent = Loader->GetNodeComponentByName(Attachment.NodeName);
+                if (!NodeComponent)
                 {
                     UE_LOG(LogTemp, Warning, TEXT("⚠️ Node not found: %s in model %s"), *Attachment.NodeName, *ModelName);
                     continue;
                 }
 
-                AttachElementToNode(Attachment, NodeActor);
+                AttachElementToNode(Attachment, NodeComponent);
             }
 
             break; // done with this model
@@ -88,16 +95,92 @@ void UModelsConfigManager::AttachConfigToModel(UAssimpRuntime3DModelsImporter* L
     }
 }
 
-void UModelsConfigManager::AttachElementToNode(const FAttachmentConfig& Attachment, AActor* NodeActor)
+void UModelsConfigManager::ApplyImportSettings(UAssimpBulkModelImporter* BulkImporter, const FModelImportSettings& DefaultSettings) const
 {
-    if (!NodeActor) return;
+    if (!BulkImporter) return;
 
-    UWorld* World = NodeActor->GetWorld();
+    for (const FModelAttachmentConfig& Config : ModelConfigs)
+    {
+        if (Config.ImportPreset.IsEmpty() && !Config.bParallelWeldAndNormals && Config.SpawnBackend.IsEmpty() && Config.SpawnHierarchy.IsEmpty() && Config.CollisionMode.IsEmpty() && Config.MaxConvexHulls <= 0) continue;
+
+        FModelImportSettings Settings = DefaultSettings;
+
+        EModelImportPreset Preset;
+        if (!Config.ImportPreset.IsEmpty())
+        {
+            if (FModelImportSettings::ParsePreset(Config.ImportPreset, Preset))
+            {
+                Settings.ApplyPreset(Preset);
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("⚠️ Unknown ImportPreset: %s for model %s"), *Config.ImportPreset, *Config.ModelName);
+            }
+        }
+
+        if (Config.bParallelWeldAndNormals)
+        {
+            Settings.bParallelWeldAndNormals = true;
+        }
+
+        EModelSpawnBackend Backend;
+        if (!Config.SpawnBackend.IsEmpty())
+        {
+            if (FModelImportSettings::ParseSpawnBackend(Config.SpawnBackend, Backend))
+            {
+                Settings.SpawnBackend = Backend;
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("⚠️ Unknown SpawnBackend: %s for model %s"), *Config.SpawnBackend, *Config.ModelName);
+            }
+        }
+
+        EModelSpawnHierarchy Hierarchy;
+        if (!Config.SpawnHierarchy.IsEmpty())
+        {
+            if (FModelImportSettings::ParseSpawnHierarchy(Config.SpawnHierarchy, Hierarchy))
+            {
+                Settings.SpawnHierarchy = Hierarchy;
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("⚠️ Unknown SpawnHierarchy: %s for model %s"), *Config.SpawnHierarchy, *Config.ModelName);
+            }
+        }
+
+        EModelCollisionMode CollisionMode;
+        if (!Config.CollisionMode.IsEmpty())
+        {
+            if (FModelImportSettings::ParseCollisionMode(Config.CollisionMode, CollisionMode))
+            {
+                Settings.CollisionMode = CollisionMode;
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("⚠️ Unknown CollisionMode: %s for model %s"), *Config.CollisionMode, *Config.ModelName);
+            }
+        }
+
+        if (Config.MaxConvexHulls > 0)
+        {
+            Settings.MaxConvexHulls = Config.MaxConvexHulls;
+        }
+
+        BulkImporter->SetModelImportSettings(Config.ModelName, Settings);
+    }
+}
+
+void UModelsConfigManager::AttachElementToNode(const FAttachmentConfig& Attachment, USceneComponent* NodeComponent)
+{
+    if (!NodeComponent) return;
+
+    UWorld* World = NodeComponent->GetWorld();
     if (!World) return;
 
     // Use the node's location/rotation
-    FVector Location = NodeActor->GetActorLocation();
-    FRotator Rotation = NodeActor->GetActorRotation();
+    FVector Location = NodeComponent->GetComponentLocation();
+    FRotator Rotation = NodeComponent->GetComponentRotation();
 
     if (Attachment.AttachmentType == "StaticMesh")
     {
@@ -109,7 +192,7 @@ void UModelsConfigManager::AttachElementToNode(const FAttachmentConfig& Attachme
             MeshComp->SetStaticMesh(Mesh);
             MeshComp->RegisterComponent();
             MeshActor->SetRootComponent(MeshComp);
-            MeshActor->AttachToActor(NodeActor, FAttachmentTransformRules::KeepRelativeTransform);
+            MeshActor->AttachToComponent(NodeComponent, FAttachmentTransformRules::KeepRelativeTransform);
             UE_LOG(LogTemp, Display, TEXT("✅ Attached StaticMesh Actor to node %s"), *Attachment.NodeName);
         }
     }
@@ -125,7 +208,7 @@ void UModelsConfigManager::AttachElementToNode(const FAttachmentConfig& Attachme
             VFXComp->SetTemplate(VFX);
             VFXComp->RegisterComponent();
             VFXActor->SetRootComponent(VFXComp);
-            VFXActor->AttachToActor(NodeActor, FAttachmentTransformRules::KeepRelativeTransform);
+            VFXActor->AttachToComponent(NodeComponent, FAttachmentTransformRules::KeepRelativeTransform);
             UE_LOG(LogTemp, Display, TEXT("✅ Attached VFX Actor to node %s"), *Attachment.NodeName);
         }
         */
@@ -138,7 +221,7 @@ void UModelsConfigManager::AttachElementToNode(const FAttachmentConfig& Attachme
             AActor* BPActor = World->SpawnActor<AActor>(BPClass, Location, Rotation);
             if (BPActor)
             {
-                BPActor->AttachToActor(NodeActor, FAttachmentTransformRules::KeepRelativeTransform);
+                BPActor->AttachToComponent(NodeComponent, FAttachmentTransformRules::KeepRelativeTransform);
                 UE_LOG(LogTemp, Display, TEXT("✅ Spawned Blueprint Actor at node %s"), *Attachment.NodeName);
             }
         }
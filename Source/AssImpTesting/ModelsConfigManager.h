@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "AssimpRuntime3DModelsImporter.h"
+#include "AssimpBulkModelImporter.h"
 #include "ModelsConfigManager.generated.h"
 
 USTRUCT()
@@ -33,6 +34,24 @@ struct FModelAttachmentConfig
     UPROPERTY()
     FString ModelID;
 
+    UPROPERTY()
+    FString ImportPreset; // FastPreview, Balanced, ShippingQuality; empty = default
+
+    UPROPERTY()
+    bool bParallelWeldAndNormals = false; // Opt into the parallel weld/normal/tangent pipeline (scans, huge CAD meshes)
+
+    UPROPERTY()
+    FString SpawnBackend; // ProceduralMesh, StaticMesh; empty = default
+
+    UPROPERTY()
+    FString SpawnHierarchy; // ActorPerNode, ComponentPerNode; empty = default
+
+    UPROPERTY()
+    FString CollisionMode; // None, BoundingBox, SimplifiedConvex, ConvexDecomposition, Complex; empty = default
+
+    UPROPERTY()
+    int32 MaxConvexHulls = 0; // Hull budget per mesh for ConvexDecomposition; 0 = default
+
     UPROPERTY()
     TArray<FAttachmentConfig> Attachments;
 };
@@ -46,8 +65,9 @@ class ASSIMPTESTING_API UModelsConfigManager : public UObject
 public:
     void LoadConfig(FString FilePath);
     void AttachConfigToModel(UAssimpRuntime3DModelsImporter* Loader);
+    void ApplyImportSettings(UAssimpBulkModelImporter* BulkImporter, const FModelImportSettings& DefaultSettings) const;
 
 private:
     TArray<FModelAttachmentConfig> ModelConfigs;
-    void AttachElementToNode(const FAttachmentConfig& Attachment, AActor* NodeActor);
+    void AttachElementToNode(const FAttachmentConfig& Attachment, USceneComponent* NodeComponent);
 };
\ No newline at end of file